@@ -0,0 +1,354 @@
+/**
+ *  @file   benchmark/LArContentBenchmark.cc
+ *
+ *  @brief  Micro-benchmarks of lar content routines that can run without a configured pandora instance, on synthetic hit topologies.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArHelpers/LArPcaHelper.h"
+#include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+
+#include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
+#include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include "SyntheticHitGenerator.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace pandora;
+using namespace lar_content;
+
+namespace
+{
+
+typedef std::function<void(const CartesianPointVector &)> Routine;
+typedef KDTreeLinkerAlgo<const CartesianVector*, 3> PointKDTree3D;
+typedef KDTreeNodeInfoT<const CartesianVector*, 3> PointKDNode3D;
+typedef std::vector<PointKDNode3D> PointKDNode3DList;
+
+const unsigned int SEED(20170801);                      ///< The seed for the synthetic hit generator
+const unsigned int SLIDING_FIT_HALF_WINDOW(20);         ///< The sliding fit half window, in layers
+const float LAYER_PITCH(0.3f);                          ///< The sliding fit layer pitch
+const float KD_SEARCH_SPAN(1.f);                        ///< The half-width of the kd-tree search box around each hit
+const unsigned int N_SVM_FEATURES(10);                  ///< The number of features used by the synthetic svm
+const unsigned int N_SUPPORT_VECTORS(500);              ///< The number of support vectors in the synthetic svm
+const double MIN_TIME_PER_ROUTINE(0.2);                 ///< The minimum total time over which to repeat each routine, in seconds
+
+/**
+ *  @brief  Time a routine on a set of hits, repeating it until the minimum total time is reached, and print the time per call
+ *
+ *  @param  routineName the routine name
+ *  @param  topologyName the topology name
+ *  @param  pointVector the hit positions
+ *  @param  routine the routine
+ */
+void RunBenchmark(const std::string &routineName, const std::string &topologyName, const CartesianPointVector &pointVector, const Routine &routine)
+{
+    try
+    {
+        // Untimed warm-up call, also establishing that the routine succeeds on these hits
+        routine(pointVector);
+
+        unsigned int nCalls(0);
+        std::chrono::duration<double> totalTime(0.);
+
+        while (totalTime.count() < MIN_TIME_PER_ROUTINE)
+        {
+            const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+            routine(pointVector);
+            totalTime += std::chrono::steady_clock::now() - startTime;
+            ++nCalls;
+        }
+
+        const double timePerCall(totalTime.count() / static_cast<double>(nCalls));
+
+        std::cout << std::left << std::setw(24) << routineName << std::setw(10) << topologyName << std::right << std::setw(10) << pointVector.size()
+                  << std::setw(10) << nCalls << std::setw(16) << 1.e6 * timePerCall << std::setw(16)
+                  << 1.e9 * timePerCall / static_cast<double>(pointVector.size()) << std::endl;
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << std::left << std::setw(24) << routineName << std::setw(10) << topologyName << std::right << std::setw(10) << pointVector.size()
+                  << "  failed: " << statusCodeException.ToString() << std::endl;
+    }
+}
+
+/**
+ *  @brief  Project 3D hit positions into the xz plane, as for the hits of a single view
+ *
+ *  @param  pointVector the 3D hit positions
+ *  @param  projectedPointVector to receive the projected hit positions
+ */
+void ProjectHits(const CartesianPointVector &pointVector, CartesianPointVector &projectedPointVector)
+{
+    projectedPointVector.clear();
+
+    for (const CartesianVector &position : pointVector)
+        projectedPointVector.push_back(CartesianVector(position.GetX(), 0.f, position.GetZ()));
+}
+
+/**
+ *  @brief  Fill the nodes of a 3D kd-tree with hit positions
+ *
+ *  @param  pointVector the hit positions, which must outlive the nodes
+ *  @param  nodes to receive the nodes
+ *
+ *  @return the bounding box of the nodes
+ */
+KDTreeCube FillKDTreeNodes(const CartesianPointVector &pointVector, PointKDNode3DList &nodes)
+{
+    MANAGED_CONTAINER<const CartesianVector*> pointList;
+
+    for (const CartesianVector &position : pointVector)
+        pointList.push_back(&position);
+
+    nodes.clear();
+    return fill_and_bound_3d_kd_tree(pointList, nodes);
+}
+
+/**
+ *  @brief  Get the features of a hit for svm scoring, from its position and that of the preceding hit
+ *
+ *  @param  pointVector the hit positions
+ *  @param  hitIndex the index of the hit
+ *  @param  features to receive the features
+ */
+void GetSvmFeatures(const CartesianPointVector &pointVector, const unsigned int hitIndex, SupportVectorMachine::DoubleVector &features)
+{
+    const CartesianVector &position(pointVector.at(hitIndex));
+    const CartesianVector &previousPosition(pointVector.at(hitIndex > 0 ? hitIndex - 1 : 0));
+    const CartesianVector displacement(position - previousPosition);
+
+    features.clear();
+    features.push_back(position.GetX());
+    features.push_back(position.GetY());
+    features.push_back(position.GetZ());
+    features.push_back(displacement.GetX());
+    features.push_back(displacement.GetY());
+    features.push_back(displacement.GetZ());
+    features.push_back(displacement.GetMagnitude());
+    features.push_back(position.GetMagnitude());
+    features.push_back(position.GetX() * position.GetZ());
+    features.push_back(position.GetY() * position.GetZ());
+}
+
+/**
+ *  @brief  Write a synthetic svm model, with fixed-seed support vectors, to an xml file
+ *
+ *  @param  fileName the xml file name
+ *  @param  svmName the svm name
+ */
+void WriteSyntheticSvm(const std::string &fileName, const std::string &svmName)
+{
+    std::mt19937 generator(SEED);
+    std::normal_distribution<double> normalDistribution(0., 1.);
+
+    std::ofstream outputFile(fileName.c_str());
+
+    if (!outputFile.is_open())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    outputFile << "<SupportVectorMachine>" << std::endl
+               << "    <Name>" << svmName << "</Name>" << std::endl
+               << "    <Machine>" << std::endl
+               << "        <KernelType>" << SupportVectorMachine::QUADRATIC << "</KernelType>" << std::endl
+               << "        <Bias>0.1</Bias>" << std::endl
+               << "        <ScaleFactor>1.</ScaleFactor>" << std::endl
+               << "        <Standardize>true</Standardize>" << std::endl
+               << "    </Machine>" << std::endl
+               << "    <Features>" << std::endl
+               << "        <MuValues>";
+
+    for (unsigned int iFeature = 0; iFeature < N_SVM_FEATURES; ++iFeature)
+        outputFile << (iFeature > 0 ? " " : "") << 0.;
+
+    outputFile << "</MuValues>" << std::endl << "        <SigmaValues>";
+
+    for (unsigned int iFeature = 0; iFeature < N_SVM_FEATURES; ++iFeature)
+        outputFile << (iFeature > 0 ? " " : "") << 100.;
+
+    outputFile << "</SigmaValues>" << std::endl << "    </Features>" << std::endl;
+
+    for (unsigned int iSupportVector = 0; iSupportVector < N_SUPPORT_VECTORS; ++iSupportVector)
+    {
+        outputFile << "    <SupportVector>" << std::endl << "        <AlphaY>" << normalDistribution(generator) << "</AlphaY>" << std::endl
+                   << "        <Values>";
+
+        for (unsigned int iFeature = 0; iFeature < N_SVM_FEATURES; ++iFeature)
+            outputFile << (iFeature > 0 ? " " : "") << normalDistribution(generator);
+
+        outputFile << "</Values>" << std::endl << "    </SupportVector>" << std::endl;
+    }
+
+    outputFile << "</SupportVectorMachine>" << std::endl;
+}
+
+/**
+ *  @brief  Run all routine benchmarks on a set of hits
+ *
+ *  @param  topologyName the topology name
+ *  @param  pointVector the hit positions
+ *  @param  svm the svm to use for scoring
+ */
+void RunBenchmarks(const std::string &topologyName, const CartesianPointVector &pointVector, const SupportVectorMachine &svm)
+{
+    CartesianPointVector projectedPointVector;
+    ProjectHits(pointVector, projectedPointVector);
+
+    RunBenchmark("TwoDSlidingFit", topologyName, projectedPointVector, [](const CartesianPointVector &hits)
+    {
+        const TwoDSlidingFitResult slidingFitResult(&hits, SLIDING_FIT_HALF_WINDOW, LAYER_PITCH);
+        (void) slidingFitResult;
+    });
+
+    RunBenchmark("ThreeDSlidingFit", topologyName, pointVector, [](const CartesianPointVector &hits)
+    {
+        const ThreeDSlidingFitResult slidingFitResult(&hits, SLIDING_FIT_HALF_WINDOW, LAYER_PITCH);
+        (void) slidingFitResult;
+    });
+
+    RunBenchmark("SlidingFitTrajectory", topologyName, pointVector, [](const CartesianPointVector &hits)
+    {
+        LArTrackStateVector trackStateVector;
+        LArPfoHelper::GetSlidingFitTrajectory(hits, hits.front(), SLIDING_FIT_HALF_WINDOW, LAYER_PITCH, trackStateVector);
+    });
+
+    RunBenchmark("Pca", topologyName, pointVector, [](const CartesianPointVector &hits)
+    {
+        CartesianVector centroid(0.f, 0.f, 0.f);
+        LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
+        LArPcaHelper::EigenVectors eigenVectors;
+        LArPcaHelper::RunPca(hits, centroid, eigenValues, eigenVectors);
+    });
+
+    RunBenchmark("KDTreeBuild", topologyName, pointVector, [](const CartesianPointVector &hits)
+    {
+        PointKDNode3DList nodes;
+        const KDTreeCube boundingRegion(FillKDTreeNodes(hits, nodes));
+
+        PointKDTree3D kdTree;
+        kdTree.build(nodes, boundingRegion);
+        kdTree.clear();
+    });
+
+    // ATTN The tree is built outside the timed routine, which then searches around every hit
+    PointKDNode3DList nodes;
+    const KDTreeCube boundingRegion(FillKDTreeNodes(pointVector, nodes));
+
+    PointKDTree3D kdTree;
+    kdTree.build(nodes, boundingRegion);
+
+    RunBenchmark("KDTreeSearch", topologyName, pointVector, [&kdTree](const CartesianPointVector &hits)
+    {
+        PointKDNode3DList found;
+
+        for (const CartesianVector &position : hits)
+        {
+            found.clear();
+            kdTree.search(build_3d_kd_search_region(position, KD_SEARCH_SPAN, KD_SEARCH_SPAN, KD_SEARCH_SPAN), found);
+        }
+    });
+
+    kdTree.clear();
+
+    RunBenchmark("SvmScore", topologyName, pointVector, [&svm](const CartesianPointVector &hits)
+    {
+        SupportVectorMachine::DoubleVector features;
+        double sumScore(0.);
+
+        for (unsigned int iHit = 0; iHit < hits.size(); ++iHit)
+        {
+            GetSvmFeatures(hits, iHit, features);
+            sumScore += svm.CalculateClassificationScore(features);
+        }
+
+        (void) sumScore;
+    });
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    std::vector<unsigned int> nHitsVector{250, 1000, 4000, 16000};
+
+    if (argc > 1)
+    {
+        nHitsVector.clear();
+
+        for (int iArg = 1; iArg < argc; ++iArg)
+            nHitsVector.push_back(static_cast<unsigned int>(std::strtoul(argv[iArg], nullptr, 10)));
+    }
+
+    try
+    {
+        const std::string svmFileName("LArContentBenchmarkSvm.xml"), svmName("BenchmarkSvm");
+        WriteSyntheticSvm(svmFileName, svmName);
+
+        SupportVectorMachine svm;
+        StatusCode svmStatusCode(STATUS_CODE_FAILURE);
+
+        try
+        {
+            svmStatusCode = svm.Initialize(svmFileName, svmName);
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            svmStatusCode = statusCodeException.GetStatusCode();
+        }
+
+        (void) std::remove(svmFileName.c_str());
+
+        if (STATUS_CODE_SUCCESS != svmStatusCode)
+            throw StatusCodeException(svmStatusCode);
+
+        std::cout << "LArContentBenchmark: seed " << SEED << ", times are wall times averaged over repeated calls" << std::endl
+                  << std::left << std::setw(24) << "Routine" << std::setw(10) << "Topology" << std::right << std::setw(10) << "NHits"
+                  << std::setw(10) << "NCalls" << std::setw(16) << "PerCall[us]" << std::setw(16) << "PerHit[ns]" << std::endl;
+
+        for (const unsigned int nHits : nHitsVector)
+        {
+            if (nHits < 2)
+                continue;
+
+            // ATTN Each topology has its own generator, so that its hits depend only on the seed and the hit count
+            CartesianPointVector pointVector;
+
+            SyntheticHitGenerator trackGenerator(SEED);
+            trackGenerator.GenerateTrack(nHits, pointVector);
+            RunBenchmarks("Track", pointVector, svm);
+
+            SyntheticHitGenerator showerGenerator(SEED);
+            showerGenerator.GenerateShower(nHits, pointVector);
+            RunBenchmarks("Shower", pointVector, svm);
+
+            SyntheticHitGenerator cosmicGenerator(SEED);
+            cosmicGenerator.GenerateCosmics(nHits, pointVector);
+            RunBenchmarks("Cosmics", pointVector, svm);
+        }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "LArContentBenchmark: exception " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,530 @@
+/**
+ *  @file   benchmark/LArContentEventBenchmark.cc
+ *
+ *  @brief  Benchmarks of lar content routines that need a configured pandora instance (tensor population and the vertex feature tools),
+ *          run on synthetic events built from the benchmark hit topologies.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+#include "Api/PandoraContentApi.h"
+
+#include "Pandora/AlgorithmHeaders.h"
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArContent.h"
+
+#include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
+
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSvmHelper.h"
+
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
+#include "larpandoracontent/LArVertex/EnergyKickFeatureTool.h"
+#include "larpandoracontent/LArVertex/GlobalAsymmetryFeatureTool.h"
+#include "larpandoracontent/LArVertex/LocalAsymmetryFeatureTool.h"
+#include "larpandoracontent/LArVertex/VertexSelectionBaseAlgorithm.h"
+
+#include "SyntheticHitGenerator.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace pandora;
+using namespace lar_content;
+
+namespace
+{
+
+const unsigned int SEED(20170801);                      ///< The seed for the synthetic hit generator
+const double MIN_TIME_PER_ROUTINE(0.2);                 ///< The minimum total time over which to repeat each routine, in seconds
+
+/**
+ *  @brief  Time a routine, repeating it until the minimum total time is reached, and print the time per call
+ *
+ *  @param  routineName the routine name
+ *  @param  nInputs the number of input objects (clusters or vertices) processed by each call
+ *  @param  routine the routine
+ */
+void RunBenchmark(const std::string &routineName, const unsigned int nInputs, const std::function<void()> &routine)
+{
+    // Untimed warm-up call, also establishing that the routine succeeds on this event
+    routine();
+
+    unsigned int nCalls(0);
+    std::chrono::duration<double> totalTime(0.);
+
+    while (totalTime.count() < MIN_TIME_PER_ROUTINE)
+    {
+        const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+        routine();
+        totalTime += std::chrono::steady_clock::now() - startTime;
+        ++nCalls;
+    }
+
+    const double timePerCall(totalTime.count() / static_cast<double>(nCalls));
+
+    std::cout << "    " << std::left << std::setw(32) << routineName << std::right << std::setw(10) << nInputs << std::setw(10) << nCalls
+              << std::setw(16) << 1.e6 * timePerCall << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  TensorPopulationBenchmarkAlgorithm class, repeatedly running a three view matching daughter algorithm configured without
+ *          tensor tools, so that each call populates and then discards the overlap tensor
+ */
+class TensorPopulationBenchmarkAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const;
+    };
+
+private:
+    StatusCode Run();
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+
+    std::string             m_tensorAlgorithmName;          ///< The name of the three view matching daughter algorithm
+    StringVector            m_inputClusterListNames;        ///< The names of the cluster lists matched by the daughter algorithm
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Algorithm *TensorPopulationBenchmarkAlgorithm::Factory::CreateAlgorithm() const
+{
+    return new TensorPopulationBenchmarkAlgorithm;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TensorPopulationBenchmarkAlgorithm::Run()
+{
+    unsigned int nClusters(0);
+
+    for (const std::string &clusterListName : m_inputClusterListNames)
+    {
+        const ClusterList *pClusterList(nullptr);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*this,
+            clusterListName, pClusterList));
+
+        if (pClusterList)
+            nClusters += pClusterList->size();
+    }
+
+    RunBenchmark("TensorPopulation", nClusters, [this]()
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, m_tensorAlgorithmName));
+    });
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TensorPopulationBenchmarkAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithm(*this, xmlHandle, "TensorAlgorithm", m_tensorAlgorithmName));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "InputClusterListNames", m_inputClusterListNames));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  VertexFeatureBenchmarkAlgorithm class, timing the vertex feature tools on the filtered vertex candidates, one vertex at a time
+ *          and batched, without selecting any vertex
+ */
+class VertexFeatureBenchmarkAlgorithm : public VertexSelectionBaseAlgorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const;
+    };
+
+    /**
+     *  @brief  Default constructor
+     */
+    VertexFeatureBenchmarkAlgorithm();
+
+private:
+    void GetVertexScoreList(const VertexVector &vertexVector, const BeamConstants &beamConstants, HitKDTree2D &kdTreeU,
+        HitKDTree2D &kdTreeV, HitKDTree2D &kdTreeW, VertexScoreList &vertexScoreList) const;
+
+    /**
+     *  @brief  Time the features of a given feature tool type for all vertex candidates, one vertex at a time and batched
+     *
+     *  @param  toolName the feature tool name
+     *  @param  vertexVector the vertex vector
+     *  @param  slidingFitDataListMap map of the sliding fit data lists
+     *  @param  beamDeweightingVector the beam deweighting scores, in vertex vector order
+     */
+    template <typename T>
+    void RunFeatureToolBenchmarks(const std::string &toolName, const VertexVector &vertexVector, const SlidingFitDataListMap &slidingFitDataListMap,
+        const FloatVector &beamDeweightingVector) const;
+
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+
+    VertexFeatureTool::FeatureToolVector m_featureToolVector; ///< The feature tool vector
+
+    StringVector            m_inputClusterListNames;        ///< The list of cluster list names
+    unsigned int            m_minClusterCaloHits;           ///< The min number of hits for a cluster to be given a sliding fit
+    unsigned int            m_slidingFitWindow;             ///< The layer window for the sliding linear fits
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Algorithm *VertexFeatureBenchmarkAlgorithm::Factory::CreateAlgorithm() const
+{
+    return new VertexFeatureBenchmarkAlgorithm;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+VertexFeatureBenchmarkAlgorithm::VertexFeatureBenchmarkAlgorithm() :
+    m_minClusterCaloHits(12),
+    m_slidingFitWindow(100)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VertexFeatureBenchmarkAlgorithm::GetVertexScoreList(const VertexVector &vertexVector, const BeamConstants &beamConstants, HitKDTree2D &,
+    HitKDTree2D &, HitKDTree2D &, VertexScoreList &) const
+{
+    ClusterList clustersU, clustersV, clustersW;
+    this->GetClusterLists(m_inputClusterListNames, clustersU, clustersV, clustersW);
+
+    SlidingFitDataList slidingFitDataListU, slidingFitDataListV, slidingFitDataListW;
+    this->CalculateClusterSlidingFits(clustersU, m_minClusterCaloHits, m_slidingFitWindow, slidingFitDataListU);
+    this->CalculateClusterSlidingFits(clustersV, m_minClusterCaloHits, m_slidingFitWindow, slidingFitDataListV);
+    this->CalculateClusterSlidingFits(clustersW, m_minClusterCaloHits, m_slidingFitWindow, slidingFitDataListW);
+
+    const SlidingFitDataListMap slidingFitDataListMap{{TPC_VIEW_U, slidingFitDataListU},
+                                                      {TPC_VIEW_V, slidingFitDataListV},
+                                                      {TPC_VIEW_W, slidingFitDataListW}};
+
+    FloatVector beamDeweightingVector;
+    for (const Vertex *const pVertex : vertexVector)
+        beamDeweightingVector.push_back(this->IsBeamModeOn() ? this->GetBeamDeweightingScore(beamConstants, pVertex) : 0.f);
+
+    this->RunFeatureToolBenchmarks<EnergyKickFeatureTool>("EnergyKickFeature", vertexVector, slidingFitDataListMap, beamDeweightingVector);
+    this->RunFeatureToolBenchmarks<LocalAsymmetryFeatureTool>("LocalAsymmetryFeature", vertexVector, slidingFitDataListMap, beamDeweightingVector);
+    this->RunFeatureToolBenchmarks<GlobalAsymmetryFeatureTool>("GlobalAsymmetryFeature", vertexVector, slidingFitDataListMap, beamDeweightingVector);
+
+    // ATTN No vertex scores are provided, so that no vertex is selected and the candidates are left unchanged
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void VertexFeatureBenchmarkAlgorithm::RunFeatureToolBenchmarks(const std::string &toolName, const VertexVector &vertexVector,
+    const SlidingFitDataListMap &slidingFitDataListMap, const FloatVector &beamDeweightingVector) const
+{
+    RunBenchmark(toolName, vertexVector.size(), [&]()
+    {
+        float bestFastScore(0.f);
+
+        for (unsigned int iVertex = 0; iVertex < vertexVector.size(); ++iVertex)
+        {
+            (void) LArSvmHelper::CalculateFeaturesOfType<T>(m_featureToolVector, this, vertexVector.at(iVertex), slidingFitDataListMap,
+                ClusterListMap(), KDTreeMap(), ShowerClusterListMap(), beamDeweightingVector.at(iVertex), bestFastScore);
+        }
+    });
+
+    RunBenchmark(toolName + "Batch", vertexVector.size(), [&]()
+    {
+        VertexPositionBatchMap vertexPositionBatchMap;
+        SlidingFitDataBatchMap slidingFitDataBatchMap;
+        this->GetFeatureBatchMaps(vertexVector, slidingFitDataListMap, vertexPositionBatchMap, slidingFitDataBatchMap);
+
+        (void) this->CalculateBatchFeaturesOfType<T>(m_featureToolVector, vertexVector, vertexPositionBatchMap, slidingFitDataBatchMap,
+            slidingFitDataListMap, ClusterListMap(), KDTreeMap(), ShowerClusterListMap(), beamDeweightingVector);
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode VertexFeatureBenchmarkAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    AlgorithmToolVector algorithmToolVector;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmToolList(*this, xmlHandle, "FeatureTools", algorithmToolVector));
+
+    for (AlgorithmTool *const pAlgorithmTool : algorithmToolVector)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArSvmHelper::AddFeatureToolToVector(pAlgorithmTool, m_featureToolVector));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
+        "InputClusterListNames", m_inputClusterListNames));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "MinClusterCaloHits", m_minClusterCaloHits));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "SlidingFitWindow", m_slidingFitWindow));
+
+    return VertexSelectionBaseAlgorithm::ReadSettings(xmlHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Write the settings for the synthetic events: hit preparation, clustering and vertex candidate creation, followed by the
+ *          tensor population and vertex feature benchmarks
+ *
+ *  @param  fileName the xml file name
+ */
+void WriteSettings(const std::string &fileName)
+{
+    std::ofstream outputFile(fileName.c_str());
+
+    if (!outputFile.is_open())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    outputFile << "<pandora>" << std::endl
+               << "    <IsMonitoringEnabled>false</IsMonitoringEnabled>" << std::endl
+               << "    <ShouldDisplayAlgorithmInfo>false</ShouldDisplayAlgorithmInfo>" << std::endl
+               << "    <algorithm type = \"LArPreProcessing\">" << std::endl
+               << "        <OutputCaloHitListNameU>CaloHitListU</OutputCaloHitListNameU>" << std::endl
+               << "        <OutputCaloHitListNameV>CaloHitListV</OutputCaloHitListNameV>" << std::endl
+               << "        <OutputCaloHitListNameW>CaloHitListW</OutputCaloHitListNameW>" << std::endl
+               << "        <FilteredCaloHitListName>CaloHitList2D</FilteredCaloHitListName>" << std::endl
+               << "        <CurrentCaloHitListReplacement>CaloHitList2D</CurrentCaloHitListReplacement>" << std::endl
+               << "    </algorithm>" << std::endl;
+
+    for (const std::string view : {"U", "V", "W"})
+    {
+        outputFile << "    <algorithm type = \"LArClusteringParent\">" << std::endl
+                   << "        <algorithm type = \"LArTrackClusterCreation\" description = \"ClusterFormation\"/>" << std::endl
+                   << "        <InputCaloHitListName>CaloHitList" << view << "</InputCaloHitListName>" << std::endl
+                   << "        <ClusterListName>Clusters" << view << "</ClusterListName>" << std::endl
+                   << "        <ReplaceCurrentCaloHitList>true</ReplaceCurrentCaloHitList>" << std::endl
+                   << "        <ReplaceCurrentClusterList>true</ReplaceCurrentClusterList>" << std::endl
+                   << "    </algorithm>" << std::endl;
+    }
+
+    outputFile << "    <algorithm type = \"LArCandidateVertexCreation\">" << std::endl
+               << "        <InputClusterListNames>ClustersU ClustersV ClustersW</InputClusterListNames>" << std::endl
+               << "        <OutputVertexListName>CandidateVertices</OutputVertexListName>" << std::endl
+               << "        <ReplaceCurrentVertexList>true</ReplaceCurrentVertexList>" << std::endl
+               << "    </algorithm>" << std::endl
+               << "    <algorithm type = \"LArTensorPopulationBenchmark\">" << std::endl
+               << "        <algorithm type = \"LArThreeDTransverseTracks\" description = \"TensorAlgorithm\">" << std::endl
+               << "            <InputClusterListNameU>ClustersU</InputClusterListNameU>" << std::endl
+               << "            <InputClusterListNameV>ClustersV</InputClusterListNameV>" << std::endl
+               << "            <InputClusterListNameW>ClustersW</InputClusterListNameW>" << std::endl
+               << "            <OutputPfoListName>TrackParticles3D</OutputPfoListName>" << std::endl
+               << "            <TrackTools></TrackTools>" << std::endl
+               << "        </algorithm>" << std::endl
+               << "        <InputClusterListNames>ClustersU ClustersV ClustersW</InputClusterListNames>" << std::endl
+               << "    </algorithm>" << std::endl
+               << "    <algorithm type = \"LArVertexFeatureBenchmark\">" << std::endl
+               << "        <InputCaloHitListNames>CaloHitListU CaloHitListV CaloHitListW</InputCaloHitListNames>" << std::endl
+               << "        <InputClusterListNames>ClustersU ClustersV ClustersW</InputClusterListNames>" << std::endl
+               << "        <OutputVertexListName>BenchmarkVertices</OutputVertexListName>" << std::endl
+               << "        <ReplaceCurrentVertexList>false</ReplaceCurrentVertexList>" << std::endl
+               << "        <FeatureTools>" << std::endl
+               << "            <tool type = \"LArEnergyKickFeature\"/>" << std::endl
+               << "            <tool type = \"LArLocalAsymmetryFeature\"/>" << std::endl
+               << "            <tool type = \"LArGlobalAsymmetryFeature\"/>" << std::endl
+               << "        </FeatureTools>" << std::endl
+               << "    </algorithm>" << std::endl
+               << "</pandora>" << std::endl;
+}
+
+/**
+ *  @brief  Create a single large tpc, containing all of the synthetic hits
+ *
+ *  @param  pandora the pandora instance
+ */
+void CreateGeometry(const Pandora &pandora)
+{
+    PandoraApi::Geometry::LArTPC::Parameters parameters;
+    parameters.m_larTPCVolumeId = 0;
+    parameters.m_centerX = 0.f;
+    parameters.m_centerY = 0.f;
+    parameters.m_centerZ = 0.f;
+    parameters.m_widthX = 10000.f;
+    parameters.m_widthY = 10000.f;
+    parameters.m_widthZ = 10000.f;
+    parameters.m_wirePitchU = 0.3f;
+    parameters.m_wirePitchV = 0.3f;
+    parameters.m_wirePitchW = 0.3f;
+    parameters.m_wireAngleU = static_cast<float>(M_PI / 3.);
+    parameters.m_wireAngleV = static_cast<float>(-M_PI / 3.);
+    parameters.m_wireAngleW = 0.f;
+    parameters.m_sigmaUVW = 1.f;
+    parameters.m_isDriftInPositiveX = true;
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LArTPC::Create(pandora, parameters));
+}
+
+/**
+ *  @brief  Create the calo hits of a synthetic event, projecting each 3D hit position into the u, v and w views
+ *
+ *  @param  pandora the pandora instance
+ *  @param  pointVector the 3D hit positions
+ */
+void CreateCaloHits(const Pandora &pandora, const CartesianPointVector &pointVector)
+{
+    const LArCaloHitFactory caloHitFactory;
+
+    for (const CartesianVector &position : pointVector)
+    {
+        for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+        {
+            LArCaloHitParameters parameters;
+            parameters.m_positionVector = LArGeometryHelper::ProjectPosition(pandora, position, hitType);
+            parameters.m_expectedDirection = CartesianVector(0.f, 0.f, 1.f);
+            parameters.m_cellNormalVector = CartesianVector(0.f, 0.f, 1.f);
+            parameters.m_cellGeometry = RECTANGULAR;
+            parameters.m_cellSize0 = 0.5f;
+            parameters.m_cellSize1 = 0.3f;
+            parameters.m_cellThickness = 0.3f;
+            parameters.m_nCellRadiationLengths = 1.f;
+            parameters.m_nCellInteractionLengths = 1.f;
+            parameters.m_time = 0.f;
+            parameters.m_inputEnergy = 1.f;
+            parameters.m_mipEquivalentEnergy = 1.f;
+            parameters.m_electromagneticEnergy = 0.001f;
+            parameters.m_hadronicEnergy = 0.001f;
+            parameters.m_isDigital = false;
+            parameters.m_hitType = hitType;
+            parameters.m_hitRegion = SINGLE_REGION;
+            parameters.m_layer = 0;
+            parameters.m_isInOuterSamplingLayer = false;
+            parameters.m_pParentAddress = static_cast<const void*>(&position);
+            parameters.m_larTPCVolumeId = 0;
+
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(pandora, parameters, caloHitFactory));
+        }
+    }
+}
+
+/**
+ *  @brief  Create a synthetic event and run the benchmarks on it
+ *
+ *  @param  pandora the pandora instance
+ *  @param  topologyName the topology name
+ *  @param  pointVector the 3D hit positions
+ */
+void RunBenchmarks(const Pandora &pandora, const std::string &topologyName, const CartesianPointVector &pointVector)
+{
+    std::cout << topologyName << ", " << pointVector.size() << " hits" << std::endl;
+
+    try
+    {
+        CreateCaloHits(pandora, pointVector);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "    failed: " << statusCodeException.ToString() << std::endl;
+    }
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    std::vector<unsigned int> nHitsVector{250, 1000, 4000};
+
+    if (argc > 1)
+    {
+        nHitsVector.clear();
+
+        for (int iArg = 1; iArg < argc; ++iArg)
+            nHitsVector.push_back(static_cast<unsigned int>(std::strtoul(argv[iArg], nullptr, 10)));
+    }
+
+    const Pandora *const pPandora(new Pandora());
+    MultiPandoraApi::AddPrimaryPandoraInstance(pPandora);
+
+    try
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(*pPandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(*pPandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new LArPseudoLayerPlugin));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(*pPandora, new LArRotationalTransformationPlugin));
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(*pPandora, "LArTensorPopulationBenchmark",
+            new TensorPopulationBenchmarkAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(*pPandora, "LArVertexFeatureBenchmark",
+            new VertexFeatureBenchmarkAlgorithm::Factory));
+
+        // ATTN The geometry is created before the settings are read, so that the plugins see the tpc
+        CreateGeometry(*pPandora);
+
+        const std::string settingsFileName("LArContentEventBenchmarkSettings.xml");
+        WriteSettings(settingsFileName);
+        const StatusCode settingsStatusCode(PandoraApi::ReadSettings(*pPandora, settingsFileName));
+        (void) std::remove(settingsFileName.c_str());
+
+        if (STATUS_CODE_SUCCESS != settingsStatusCode)
+            throw StatusCodeException(settingsStatusCode);
+
+        std::cout << "LArContentEventBenchmark: seed " << SEED << ", times are wall times averaged over repeated calls" << std::endl
+                  << "    " << std::left << std::setw(32) << "Routine" << std::right << std::setw(10) << "NInputs" << std::setw(10) << "NCalls"
+                  << std::setw(16) << "PerCall[us]" << std::endl;
+
+        for (const unsigned int nHits : nHitsVector)
+        {
+            if (nHits < 2)
+                continue;
+
+            // ATTN Each topology has its own generator, so that its hits depend only on the seed and the hit count
+            CartesianPointVector pointVector;
+
+            SyntheticHitGenerator trackGenerator(SEED);
+            trackGenerator.GenerateTrack(nHits, pointVector);
+            RunBenchmarks(*pPandora, "Track", pointVector);
+
+            SyntheticHitGenerator showerGenerator(SEED);
+            showerGenerator.GenerateShower(nHits, pointVector);
+            RunBenchmarks(*pPandora, "Shower", pointVector);
+
+            SyntheticHitGenerator cosmicGenerator(SEED);
+            cosmicGenerator.GenerateCosmics(nHits, pointVector);
+            RunBenchmarks(*pPandora, "Cosmics", pointVector);
+        }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "LArContentEventBenchmark: exception " << statusCodeException.ToString() << std::endl;
+        MultiPandoraApi::DeletePandoraInstances(pPandora);
+        return 1;
+    }
+
+    MultiPandoraApi::DeletePandoraInstances(pPandora);
+    return 0;
+}
@@ -0,0 +1,247 @@
+/**
+ *  @file   benchmark/LArContentReplay.cc
+ *
+ *  @brief  Replay driver, running stored events through a full lar content reconstruction chain and reporting the wall time per event.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Pandora/StatusCodes.h"
+
+#include "Persistency/BinaryFileReader.h"
+#include "Persistency/XmlFileReader.h"
+
+#include "larpandoracontent/LArContent.h"
+
+#include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
+
+#include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
+
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <unistd.h>
+
+using namespace pandora;
+using namespace lar_content;
+
+namespace
+{
+
+/**
+ *  @brief  Parameters class
+ */
+class Parameters
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    Parameters();
+
+    std::string     m_settingsFile;         ///< The path to the master pandora settings file
+    std::string     m_geometryFileName;     ///< The geometry file name, read before the settings so that plugins can be initialized
+    std::string     m_eventFileNameList;    ///< The colon-separated list of event file names
+    int             m_nEventsToProcess;     ///< The number of events to process, negative to process all events
+    int             m_skipToEvent;          ///< The index of the first event to process in the first event file, negative to use the settings
+};
+
+Parameters::Parameters() :
+    m_nEventsToProcess(-1),
+    m_skipToEvent(-1)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Print the command line options
+ */
+void PrintOptions()
+{
+    std::cout << std::endl << "./bin/LArContentReplay " << std::endl
+              << "    -i Settings.xml         (required, master settings, with LArEventReading as its first algorithm)" << std::endl
+              << "    -g Geometry.pndr        (optional, geometry file, read before the settings; omit the GeometryFileName setting if used)" << std::endl
+              << "    -e EventsA.pndr:B.pndr  (optional, colon-separated event files, overriding the EventFileNameList setting)" << std::endl
+              << "    -n NEventsToProcess     (optional, all events by default)" << std::endl
+              << "    -s SkipToEvent          (optional, overriding the SkipToEvent setting)" << std::endl << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Parse the command line arguments
+ *
+ *  @param  argc the number of arguments
+ *  @param  argv the argument values
+ *  @param  parameters to receive the parameters
+ *
+ *  @return whether the arguments are valid
+ */
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters)
+{
+    int cOpt(0);
+
+    while ((cOpt = getopt(argc, argv, "i:g:e:n:s:h")) != -1)
+    {
+        switch (cOpt)
+        {
+        case 'i':
+            parameters.m_settingsFile = optarg;
+            break;
+        case 'g':
+            parameters.m_geometryFileName = optarg;
+            break;
+        case 'e':
+            parameters.m_eventFileNameList = optarg;
+            break;
+        case 'n':
+            parameters.m_nEventsToProcess = std::atoi(optarg);
+            break;
+        case 's':
+            parameters.m_skipToEvent = std::atoi(optarg);
+            break;
+        case 'h':
+        default:
+            PrintOptions();
+            return false;
+        }
+    }
+
+    if (parameters.m_settingsFile.empty())
+    {
+        PrintOptions();
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Read the geometry file into a pandora instance, choosing the reader from the file extension
+ *
+ *  @param  pandora the pandora instance
+ *  @param  geometryFileName the geometry file name
+ */
+void ReadGeometry(const Pandora &pandora, const std::string &geometryFileName)
+{
+    const std::string::size_type extensionPosition(geometryFileName.find_last_of("."));
+    const std::string extension((std::string::npos == extensionPosition) ? "" : geometryFileName.substr(extensionPosition + 1));
+
+    if ("pndr" == extension)
+    {
+        BinaryFileReader fileReader(pandora, geometryFileName);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, fileReader.ReadGeometry());
+    }
+    else if ("xml" == extension)
+    {
+        XmlFileReader fileReader(pandora, geometryFileName);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, fileReader.ReadGeometry());
+    }
+    else
+    {
+        std::cout << "LArContentReplay: unknown geometry file type " << geometryFileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Configure the primary pandora instance
+ *
+ *  @param  parameters the parameters
+ *  @param  pPrimaryPandora the address of the primary pandora instance
+ */
+void ConfigurePrimaryPandoraInstance(const Parameters &parameters, const Pandora *const pPrimaryPandora)
+{
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(*pPrimaryPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(*pPrimaryPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPrimaryPandora, new LArPseudoLayerPlugin));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(*pPrimaryPandora, new LArRotationalTransformationPlugin));
+
+    if (!parameters.m_geometryFileName.empty())
+        ReadGeometry(*pPrimaryPandora, parameters.m_geometryFileName);
+
+    if (!parameters.m_eventFileNameList.empty() || (parameters.m_skipToEvent >= 0))
+    {
+        EventReadingAlgorithm::ExternalEventReadingParameters *const pEventReadingParameters(new EventReadingAlgorithm::ExternalEventReadingParameters);
+        pEventReadingParameters->m_eventFileNameList = parameters.m_eventFileNameList;
+
+        if (parameters.m_skipToEvent >= 0)
+            pEventReadingParameters->m_skipToEvent = static_cast<unsigned int>(parameters.m_skipToEvent);
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetExternalParameters(*pPrimaryPandora, "LArEventReading", pEventReadingParameters));
+    }
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPrimaryPandora, parameters.m_settingsFile));
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Parameters parameters;
+
+    if (!ParseCommandLine(argc, argv, parameters))
+        return 1;
+
+    const Pandora *const pPrimaryPandora(new Pandora());
+    MultiPandoraApi::AddPrimaryPandoraInstance(pPrimaryPandora);
+
+    int nEvents(0);
+    std::chrono::duration<double> totalTime(0.);
+
+    try
+    {
+        ConfigurePrimaryPandoraInstance(parameters, pPrimaryPandora);
+
+        while ((parameters.m_nEventsToProcess < 0) || (nEvents < parameters.m_nEventsToProcess))
+        {
+            const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+
+            try
+            {
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pPrimaryPandora));
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pPrimaryPandora));
+            }
+            catch (const StopProcessingException &)
+            {
+                break;
+            }
+
+            const std::chrono::duration<double> eventTime(std::chrono::steady_clock::now() - startTime);
+            totalTime += eventTime;
+
+            std::cout << "LArContentReplay: event " << nEvents << ", " << 1.e3 * eventTime.count() << " ms" << std::endl;
+            ++nEvents;
+        }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "LArContentReplay: exception " << statusCodeException.ToString() << std::endl;
+        MultiPandoraApi::DeletePandoraInstances(pPrimaryPandora);
+        return 1;
+    }
+
+    std::cout << "LArContentReplay: processed " << nEvents << " events";
+
+    if (nEvents > 0)
+        std::cout << ", mean " << 1.e3 * totalTime.count() / static_cast<double>(nEvents) << " ms per event";
+
+    std::cout << std::endl;
+
+    MultiPandoraApi::DeletePandoraInstances(pPrimaryPandora);
+    return 0;
+}
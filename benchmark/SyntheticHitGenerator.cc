@@ -0,0 +1,118 @@
+/**
+ *  @file   benchmark/SyntheticHitGenerator.cc
+ *
+ *  @brief  Implementation of the synthetic hit generator class.
+ *
+ *  $Log: $
+ */
+
+#include "SyntheticHitGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+SyntheticHitGenerator::SyntheticHitGenerator(const unsigned int seed) :
+    m_generator(seed),
+    m_hitSpacing(0.3f),
+    m_positionSmearing(0.1f),
+    m_detectorWidth(400.f),
+    m_detectorLength(1000.f),
+    m_nHitsPerCosmic(500)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticHitGenerator::GenerateTrack(const unsigned int nHits, CartesianPointVector &pointVector)
+{
+    pointVector.clear();
+    this->AddTrackHits(CartesianVector(0.f, 0.f, 0.f), this->GetRandomDirection(), nHits, pointVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticHitGenerator::GenerateShower(const unsigned int nHits, CartesianPointVector &pointVector)
+{
+    pointVector.clear();
+
+    const CartesianVector axis(this->GetRandomDirection());
+    const CartesianVector seedVector(std::fabs(axis.GetY()) < 0.9f ? CartesianVector(0.f, 1.f, 0.f) : CartesianVector(1.f, 0.f, 0.f));
+    const CartesianVector ortho1(axis.GetCrossProduct(seedVector).GetUnitVector());
+    const CartesianVector ortho2(axis.GetCrossProduct(ortho1));
+
+    // Longitudinal profile falls exponentially, with the transverse spread growing along the shower
+    std::exponential_distribution<float> longitudinalDistribution(1.f / 30.f);
+    std::normal_distribution<float> unitNormalDistribution(0.f, 1.f);
+
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+    {
+        const float longitudinal(longitudinalDistribution(m_generator));
+        const float transverseSigma(1.f + 0.1f * longitudinal);
+        const float transverse1(transverseSigma * unitNormalDistribution(m_generator));
+        const float transverse2(transverseSigma * unitNormalDistribution(m_generator));
+
+        pointVector.push_back(axis * longitudinal + ortho1 * transverse1 + ortho2 * transverse2);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticHitGenerator::GenerateCosmics(const unsigned int nHits, CartesianPointVector &pointVector)
+{
+    pointVector.clear();
+
+    std::uniform_real_distribution<float> xDistribution(-0.5f * m_detectorWidth, 0.5f * m_detectorWidth);
+    std::uniform_real_distribution<float> zDistribution(0.f, m_detectorLength);
+
+    while (pointVector.size() < nHits)
+    {
+        CartesianVector direction(this->GetRandomDirection());
+
+        if (direction.GetY() > 0.f)
+            direction = direction * -1.f;
+
+        // ATTN Draws are made in separate statements, as the evaluation order of function arguments is unspecified
+        const float startX(xDistribution(m_generator));
+        const float startZ(zDistribution(m_generator));
+        const CartesianVector startPosition(startX, 0.5f * m_detectorWidth, startZ);
+        const unsigned int nTrackHits(std::min(m_nHitsPerCosmic, nHits - static_cast<unsigned int>(pointVector.size())));
+        this->AddTrackHits(startPosition, direction, nTrackHits, pointVector);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector SyntheticHitGenerator::GetRandomDirection()
+{
+    std::uniform_real_distribution<float> cosThetaDistribution(-1.f, 1.f);
+    std::uniform_real_distribution<float> phiDistribution(0.f, 2.f * static_cast<float>(M_PI));
+
+    const float cosTheta(cosThetaDistribution(m_generator));
+    const float sinTheta(std::sqrt(std::max(0.f, 1.f - cosTheta * cosTheta)));
+    const float phi(phiDistribution(m_generator));
+
+    return CartesianVector(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticHitGenerator::AddTrackHits(const CartesianVector &startPosition, const CartesianVector &direction, const unsigned int nHits,
+    CartesianPointVector &pointVector)
+{
+    std::normal_distribution<float> smearingDistribution(0.f, m_positionSmearing);
+
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+    {
+        const float smearingX(smearingDistribution(m_generator));
+        const float smearingY(smearingDistribution(m_generator));
+        const float smearingZ(smearingDistribution(m_generator));
+        pointVector.push_back(startPosition + direction * (m_hitSpacing * static_cast<float>(iHit)) + CartesianVector(smearingX, smearingY, smearingZ));
+    }
+}
+
+} // namespace lar_content
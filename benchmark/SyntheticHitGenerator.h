@@ -0,0 +1,86 @@
+/**
+ *  @file   benchmark/SyntheticHitGenerator.h
+ *
+ *  @brief  Header file for the synthetic hit generator class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SYNTHETIC_HIT_GENERATOR_H
+#define LAR_SYNTHETIC_HIT_GENERATOR_H 1
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/PandoraInternal.h"
+
+#include <random>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  SyntheticHitGenerator class, producing reproducible 3D hit positions for track-like, shower-like and cosmic-dense topologies
+ */
+class SyntheticHitGenerator
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  seed the seed for the random number generator
+     */
+    SyntheticHitGenerator(const unsigned int seed);
+
+    /**
+     *  @brief  Generate the hits of a single straight track, with hits spaced by roughly one wire pitch
+     *
+     *  @param  nHits the number of hits to generate
+     *  @param  pointVector to receive the hit positions
+     */
+    void GenerateTrack(const unsigned int nHits, pandora::CartesianPointVector &pointVector);
+
+    /**
+     *  @brief  Generate the hits of a single shower, spreading transversely as it develops along its axis
+     *
+     *  @param  nHits the number of hits to generate
+     *  @param  pointVector to receive the hit positions
+     */
+    void GenerateShower(const unsigned int nHits, pandora::CartesianPointVector &pointVector);
+
+    /**
+     *  @brief  Generate the hits of many downward-going cosmic-ray tracks crossing the detector volume
+     *
+     *  @param  nHits the number of hits to generate
+     *  @param  pointVector to receive the hit positions
+     */
+    void GenerateCosmics(const unsigned int nHits, pandora::CartesianPointVector &pointVector);
+
+private:
+    /**
+     *  @brief  Get a random unit vector, uniformly distributed in solid angle
+     *
+     *  @return the unit vector
+     */
+    pandora::CartesianVector GetRandomDirection();
+
+    /**
+     *  @brief  Add the hits of a straight track to a point vector
+     *
+     *  @param  startPosition the start position of the track
+     *  @param  direction the unit direction of the track
+     *  @param  nHits the number of hits to add
+     *  @param  pointVector to receive the hit positions
+     */
+    void AddTrackHits(const pandora::CartesianVector &startPosition, const pandora::CartesianVector &direction, const unsigned int nHits,
+        pandora::CartesianPointVector &pointVector);
+
+    std::mt19937                m_generator;            ///< The random number generator
+    const float                 m_hitSpacing;           ///< The spacing between consecutive track hits
+    const float                 m_positionSmearing;     ///< The gaussian smearing applied to each hit coordinate
+    const float                 m_detectorWidth;        ///< The full width of the detector volume, in x and in y
+    const float                 m_detectorLength;       ///< The full length of the detector volume, in z
+    const unsigned int          m_nHitsPerCosmic;       ///< The number of hits per cosmic-ray track
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SYNTHETIC_HIT_GENERATOR_H
@@ -161,6 +161,7 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
     const float layerPitch(pFirstLArTPC->GetWirePitchW());
 
     PfoToSlidingFitsMap pfoToSlidingFitsMap;
+    PfoVector fittedPfos;
 
     for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
     {
@@ -168,28 +169,60 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
         if (!this->GetValid3DCluster(pPfo, pCluster) || !pCluster)
             continue;
 
-        (void) pfoToSlidingFitsMap.insert(PfoToSlidingFitsMap::value_type(pPfo, std::make_pair(
-            ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)))); // TODO Configurable
+        if (pfoToSlidingFitsMap.insert(PfoToSlidingFitsMap::value_type(pPfo, std::make_pair(
+            ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)))).second) // TODO Configurable
+        {
+            fittedPfos.push_back(pPfo);
+        }
     }
 
-    for (const ParticleFlowObject *const pPfo1 : parentCosmicRayPfos)
+    // Index the pfo endpoints in a grid, so that only pfo pairs with endpoints close enough to pass CheckAssociation are compared
+    const float cellSize(this->GetMaxEndpointSeparation());
+    GridCellToPfoIndicesMap gridCellToPfoIndicesMap;
+
+    for (unsigned int iPfo = 0; iPfo < fittedPfos.size(); ++iPfo)
     {
-        PfoToSlidingFitsMap::const_iterator iter1(pfoToSlidingFitsMap.find(pPfo1));
-        if (pfoToSlidingFitsMap.end() == iter1)
-            continue;
+        const ThreeDSlidingFitResult &fitPos(pfoToSlidingFitsMap.at(fittedPfos.at(iPfo)).first);
+        gridCellToPfoIndicesMap[this->GetGridCell(fitPos.GetGlobalMinLayerPosition(), cellSize)].push_back(iPfo);
+        gridCellToPfoIndicesMap[this->GetGridCell(fitPos.GetGlobalMaxLayerPosition(), cellSize)].push_back(iPfo);
+    }
 
-        const ThreeDSlidingFitResult &fitPos1(iter1->second.first), &fitDir1(iter1->second.second);
+    std::unordered_map<const ParticleFlowObject *, PfoSet> pfoAssociationSetMap;
 
-        for (const ParticleFlowObject *const pPfo2 : parentCosmicRayPfos)
+    for (unsigned int iPfo1 = 0; iPfo1 < fittedPfos.size(); ++iPfo1)
+    {
+        const ParticleFlowObject *const pPfo1(fittedPfos.at(iPfo1));
+        const ThreeDSlidingFitResult &fitPos1(pfoToSlidingFitsMap.at(pPfo1).first), &fitDir1(pfoToSlidingFitsMap.at(pPfo1).second);
+
+        // ATTN Candidates are visited in input order, so that the association lists are unchanged by the spatial pruning
+        std::set<unsigned int> candidateIndices;
+
+        for (const CartesianVector &endPoint : {fitPos1.GetGlobalMinLayerPosition(), fitPos1.GetGlobalMaxLayerPosition()})
         {
-            if (pPfo1 == pPfo2)
-                continue;
+            const GridCell gridCell(this->GetGridCell(endPoint, cellSize));
 
-            PfoToSlidingFitsMap::const_iterator iter2(pfoToSlidingFitsMap.find(pPfo2));
-            if (pfoToSlidingFitsMap.end() == iter2)
+            for (int iX = std::get<0>(gridCell) - 1; iX <= std::get<0>(gridCell) + 1; ++iX)
+            {
+                for (int iY = std::get<1>(gridCell) - 1; iY <= std::get<1>(gridCell) + 1; ++iY)
+                {
+                    for (int iZ = std::get<2>(gridCell) - 1; iZ <= std::get<2>(gridCell) + 1; ++iZ)
+                    {
+                        GridCellToPfoIndicesMap::const_iterator cellIter(gridCellToPfoIndicesMap.find(GridCell(iX, iY, iZ)));
+
+                        if (gridCellToPfoIndicesMap.end() != cellIter)
+                            candidateIndices.insert(cellIter->second.begin(), cellIter->second.end());
+                    }
+                }
+            }
+        }
+
+        for (const unsigned int iPfo2 : candidateIndices)
+        {
+            if (iPfo1 == iPfo2)
                 continue;
 
-            const ThreeDSlidingFitResult &fitPos2(iter2->second.first), &fitDir2(iter2->second.second);
+            const ParticleFlowObject *const pPfo2(fittedPfos.at(iPfo2));
+            const ThreeDSlidingFitResult &fitPos2(pfoToSlidingFitsMap.at(pPfo2).first), &fitDir2(pfoToSlidingFitsMap.at(pPfo2).second);
 
             // TODO Use existing LArPointingClusters and IsEmission/IsNode logic, for consistency
             if (!(this->CheckAssociation(fitPos1.GetGlobalMinLayerPosition(), fitDir1.GetGlobalMinLayerDirection() * -1.f, fitPos2.GetGlobalMinLayerPosition(), fitDir2.GetGlobalMinLayerDirection() * -1.f) ||
@@ -200,19 +233,39 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
                 continue;
             }
 
-            PfoList &pfoList1(pfoAssociationMap[pPfo1]), &pfoList2(pfoAssociationMap[pPfo2]);
+            if (pfoAssociationSetMap[pPfo1].insert(pPfo2).second)
+                pfoAssociationMap[pPfo1].push_back(pPfo2);
 
-            if (pfoList1.end() == std::find(pfoList1.begin(), pfoList1.end(), pPfo2))
-                pfoList1.push_back(pPfo2);
-
-            if (pfoList2.end() == std::find(pfoList2.begin(), pfoList2.end(), pPfo1))
-                pfoList2.push_back(pPfo1);
+            if (pfoAssociationSetMap[pPfo2].insert(pPfo1).second)
+                pfoAssociationMap[pPfo2].push_back(pPfo1);
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CosmicRayTaggingTool::GetMaxEndpointSeparation() const
+{
+    // Associated endpoints are separated by a = n * lambda - m * mu + d, with lambda, mu and |d| bounded by the cuts in CheckAssociation
+    const float deltaTheta(m_angularUncertainty * M_PI / 180.f);
+    const float maxVertexUncertainty(m_maxAssociationDist * std::sin(deltaTheta) + m_positionalUncertainty);
+    const float maxProjection(std::max(std::fabs(maxVertexUncertainty), std::fabs(m_maxAssociationDist + maxVertexUncertainty)));
+    const float maxImpactDist(std::fabs(std::sin(deltaTheta)) * 2.f * maxProjection + std::fabs(m_positionalUncertainty));
+
+    // ATTN Small safety margin, to absorb floating point rounding in the cut evaluation
+    return std::max(std::numeric_limits<float>::epsilon(), 1.01f * (2.f * maxProjection + maxImpactDist) + 1.f);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CosmicRayTaggingTool::GridCell CosmicRayTaggingTool::GetGridCell(const CartesianVector &position, const float cellSize) const
+{
+    return GridCell(static_cast<int>(std::floor(position.GetX() / cellSize)), static_cast<int>(std::floor(position.GetY() / cellSize)),
+        static_cast<int>(std::floor(position.GetZ() / cellSize)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool CosmicRayTaggingTool::CheckAssociation(const CartesianVector &endPoint1, const CartesianVector &endDir1, const CartesianVector &endPoint2,
     const CartesianVector &endDir2) const
 {
@@ -265,24 +318,14 @@ bool CosmicRayTaggingTool::CheckAssociation(const CartesianVector &endPoint1, co
 void CosmicRayTaggingTool::SliceEvent(const PfoList &parentCosmicRayPfos, const PfoToPfoListMap &pfoAssociationMap, PfoToSliceIdMap &pfoToSliceIdMap) const
 {
     SliceList sliceList;
+    PfoSet slicedPfos;
 
     for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
     {
-        bool isAlreadyInSlice(false);
-
-        for (const PfoList &slice : sliceList)
-        {
-            if (std::find(slice.begin(), slice.end(), pPfo) != slice.end())
-            {
-                isAlreadyInSlice = true;
-                break;
-            }
-        }
-
-        if (!isAlreadyInSlice)
+        if (!slicedPfos.count(pPfo))
         {
             sliceList.push_back(PfoList());
-            this->FillSlice(pPfo, pfoAssociationMap, sliceList.back());
+            this->FillSlice(pPfo, pfoAssociationMap, slicedPfos, sliceList.back());
         }
     }
 
@@ -301,9 +344,11 @@ void CosmicRayTaggingTool::SliceEvent(const PfoList &parentCosmicRayPfos, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTaggingTool::FillSlice(const ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, PfoList &slice) const
+void CosmicRayTaggingTool::FillSlice(const ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, PfoSet &slicedPfos,
+    PfoList &slice) const
 {
-    if (std::find(slice.begin(), slice.end(), pPfo) != slice.end())
+    // ATTN Associations are symmetric, so a pfo already in any slice can only have been reached from within this slice
+    if (!slicedPfos.insert(pPfo).second)
         return;
 
     slice.push_back(pPfo);
@@ -313,7 +358,7 @@ void CosmicRayTaggingTool::FillSlice(const ParticleFlowObject *const pPfo, const
     if (pfoAssociationMap.end() != iter)
     {
         for (const ParticleFlowObject *const pAssociatedPfo : iter->second)
-            this->FillSlice(pAssociatedPfo, pfoAssociationMap, slice);
+            this->FillSlice(pAssociatedPfo, pfoAssociationMap, slicedPfos, slice);
     }
 }
 
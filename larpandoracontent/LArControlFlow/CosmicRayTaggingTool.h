@@ -12,6 +12,9 @@
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include <map>
+#include <set>
+#include <tuple>
 #include <unordered_map>
 
 namespace lar_content
@@ -87,6 +90,26 @@ private:
      */
     void GetPfoAssociations(const pandora::PfoList &parentCosmicRayPfos, PfoToPfoListMap &pfoAssociationMap) const;
 
+    /**
+     *  @brief  Get the maximum separation between two Pfo endpoints that can satisfy the association criteria in CheckAssociation
+     *
+     *  @return the maximum endpoint separation
+     */
+    float GetMaxEndpointSeparation() const;
+
+    typedef std::tuple<int, int, int> GridCell;
+    typedef std::map<GridCell, std::vector<unsigned int>> GridCellToPfoIndicesMap;
+
+    /**
+     *  @brief  Get the cell of the endpoint grid containing a given position
+     *
+     *  @param  position the position
+     *  @param  cellSize the grid cell size
+     *
+     *  @return the grid cell
+     */
+    GridCell GetGridCell(const pandora::CartesianVector &position, const float cellSize) const;
+
     /**
      *  @brief  Check whethe two Pfo endpoints are associated by distance of closest approach
      *
@@ -116,9 +139,11 @@ private:
      *
      *  @param  pPfo Pfo to add to the slice
      *  @param  pfoAssociationMap mapping between Pfos and other associated Pfos
+     *  @param  slicedPfos the set of Pfos already added to any slice
      *  @param  slice the slice to add Pfos to
      */
-    void FillSlice(const pandora::ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, pandora::PfoList &slice) const;
+    void FillSlice(const pandora::ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, pandora::PfoSet &slicedPfos,
+        pandora::PfoList &slice) const;
 
     /**
      *  @brief  Make a list of CRCandidates
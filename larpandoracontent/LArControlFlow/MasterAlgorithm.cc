@@ -17,6 +17,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
@@ -44,12 +45,38 @@ MasterAlgorithm::MasterAlgorithm() :
     m_pSliceNuWorkerInstance(nullptr),
     m_pSliceCRWorkerInstance(nullptr),
     m_fullWidthCRWorkerWireGaps(true),
+    m_profileExecution(false),
+    m_printEventProfile(false),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH")
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+MasterAlgorithm::~MasterAlgorithm()
+{
+    if (!m_profileExecution)
+        return;
+
+    LArProfilingHelper::PrintJobProfile();
+
+    if (!m_profilingFileName.empty())
+    {
+        try
+        {
+            LArProfilingHelper::WriteJobProfile(m_profilingFileName);
+        }
+        catch (const StatusCodeException &)
+        {
+        }
+    }
+
+    LArProfilingHelper::SetProfilingEnabled(false);
+    LArProfilingHelper::Reset();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void MasterAlgorithm::ShiftPfoHierarchy(const ParticleFlowObject *const pParentPfo, const PfoToLArTPCMap &pfoToLArTPCMap, const float x0) const
 {
     if (!pParentPfo->GetParentPfoList().empty())
@@ -144,6 +171,14 @@ void MasterAlgorithm::StitchPfos(const ParticleFlowObject *const pPfoToEnlarge,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void MasterAlgorithm::GetCRWorkerLArTPCs(LArTPCVector &larTPCVector) const
+{
+    for (const Pandora *const pCRWorker : m_crWorkerInstances)
+        larTPCVector.push_back(&(pCRWorker->GetGeometry()->GetLArTPC()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::Initialize()
 {
     try
@@ -208,6 +243,10 @@ StatusCode MasterAlgorithm::Run()
     }
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Reset());
+
+    if (m_profileExecution)
+        LArProfilingHelper::EndEvent(m_printEventProfile);
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -264,6 +303,7 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
         if (m_printOverallRecoStatus)
             std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
 
+        const LArProfilingHelper::ScopedTimer scopedTimer("MasterAlgorithm/CRWorkerInstance");
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
     }
 
@@ -305,7 +345,10 @@ StatusCode MasterAlgorithm::StitchCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap)
     }
 
     for (StitchingBaseTool *const pStitchingTool : m_stitchingToolVector)
+    {
+        const LArProfilingHelper::ScopedTimer scopedTimer(pStitchingTool);
         pStitchingTool->Run(this, pRecreatedCRPfos, pfoToLArTPCMap);
+    }
 
     if (m_visualizeOverallRecoStatus)
     {
@@ -331,7 +374,10 @@ StatusCode MasterAlgorithm::TagCosmicRayPfos(PfoList &clearCosmicRayPfos, PfoLis
     }
 
     for (CosmicRayTaggingBaseTool *const pCosmicRayTaggingTool : m_cosmicRayTaggingToolVector)
+    {
+        const LArProfilingHelper::ScopedTimer scopedTimer(pCosmicRayTaggingTool);
         pCosmicRayTaggingTool->FindAmbiguousPfos(parentCosmicRayPfos, ambiguousPfos);
+    }
 
     for (const Pfo *const pPfo : parentCosmicRayPfos)
     {
@@ -401,7 +447,10 @@ StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHit
             std::cout << "Running slicing worker instance" << std::endl;
 
         const PfoList *pSlicePfos(nullptr);
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSlicingWorkerInstance));
+        {
+            const LArProfilingHelper::ScopedTimer scopedTimer("MasterAlgorithm/SlicingWorkerInstance");
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSlicingWorkerInstance));
+        }
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSlicingWorkerInstance, pSlicePfos));
 
         if (m_visualizeOverallRecoStatus)
@@ -453,7 +502,10 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
                 std::cout << "Running nu worker instance for slice " << sliceCounter << " of " << sliceVector.size() << std::endl;
 
             const PfoList *pSliceNuPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
+            {
+                const LArProfilingHelper::ScopedTimer scopedTimer("MasterAlgorithm/SliceNuWorkerInstance");
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
+            }
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
             nuSliceHypotheses.push_back(*pSliceNuPfos);
         }
@@ -464,7 +516,10 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
                 std::cout << "Running cr worker instance for slice " << sliceCounter << " of " << sliceVector.size() << std::endl;
 
             const PfoList *pSliceCRPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
+            {
+                const LArProfilingHelper::ScopedTimer scopedTimer("MasterAlgorithm/SliceCRWorkerInstance");
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
+            }
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
             crSliceHypotheses.push_back(*pSliceCRPfos);
         }
@@ -488,7 +543,10 @@ StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuS
     if (m_shouldPerformSliceId)
     {
         for (SliceIdBaseTool *const pSliceIdTool : m_sliceIdToolVector)
+        {
+            const LArProfilingHelper::ScopedTimer scopedTimer(pSliceIdTool);
             pSliceIdTool->SelectOutputPfos(nuSliceHypotheses, crSliceHypotheses, selectedSlicePfos);
+        }
     }
     else if (m_shouldRunNeutrinoRecoOption != m_shouldRunCosmicRecoOption)
     {
@@ -994,6 +1052,19 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "FullWidthCRWorkerWireGaps", m_fullWidthCRWorkerWireGaps));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ProfileExecution", m_profileExecution));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "PrintEventProfile", m_printEventProfile));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ProfilingFileName", m_profilingFileName));
+
+    // ATTN Profiling is shared by all pandora instances, so that algorithms and tools in the worker instances are also recorded
+    if (m_profileExecution)
+        LArProfilingHelper::SetProfilingEnabled(true);
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
 
@@ -39,6 +39,11 @@ public:
      */
     MasterAlgorithm();
 
+    /**
+     *  @brief  Destructor
+     */
+    ~MasterAlgorithm();
+
     /**
      *  @brief  External steering parameters class
      */
@@ -76,6 +81,13 @@ public:
     void StitchPfos(const pandora::ParticleFlowObject *const pPfoToEnlarge, const pandora::ParticleFlowObject *const pPfoToDelete,
         PfoToLArTPCMap &pfoToLArTPCMap) const;
 
+    /**
+     *  @brief  Get the tpcs of the cosmic-ray reconstruction worker instances
+     *
+     *  @param  larTPCVector to receive the tpcs, one per worker instance
+     */
+    void GetCRWorkerLArTPCs(pandora::LArTPCVector &larTPCVector) const;
+
 private:
     /**
      *  @brief  LArTPCHitList class
@@ -289,6 +301,10 @@ private:
 
     bool                        m_fullWidthCRWorkerWireGaps;        ///< Whether wire-type line gaps in cosmic-ray worker instances should cover all drift time
 
+    bool                        m_profileExecution;                 ///< Whether to profile the wall time of worker instances, algorithms and tools
+    bool                        m_printEventProfile;                ///< Whether to print the execution profile for each event
+    std::string                 m_profilingFileName;                ///< The output csv file name for the job execution profile, if any
+
     typedef std::vector<StitchingBaseTool*> StitchingToolVector;
     typedef std::vector<CosmicRayTaggingBaseTool*> CosmicRayTaggingToolVector;
     typedef std::vector<SliceIdBaseTool*> SliceIdToolVector;
@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArControlFlow/SlicingAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
+
 using namespace pandora;
 
 namespace lar_content
@@ -27,7 +29,11 @@ SlicingAlgorithm::SlicingAlgorithm() :
 StatusCode SlicingAlgorithm::Run()
 {
     SliceList sliceList;
-    m_pEventSlicingTool->RunSlicing(this, m_caloHitListNames, m_clusterListNames, sliceList);
+    {
+        const LArProfilingHelper::ScopedTimer scopedTimer(m_pEventSlicingTool);
+        m_pEventSlicingTool->RunSlicing(this, m_caloHitListNames, m_clusterListNames, sliceList);
+    }
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, m_slicingListDeletionAlgorithm));
 
     if (sliceList.empty())
@@ -29,7 +29,8 @@ StitchingCosmicRayMergingTool::StitchingCosmicRayMergingTool() :
     m_maxLongitudinalDisplacementX(15.f),
     m_maxTransverseDisplacement(5.f),
     m_relaxCosRelativeAngle(0.906),
-    m_relaxTransverseDisplacement(2.5f)
+    m_relaxTransverseDisplacement(2.5f),
+    m_tpcAdjacencyGraph(LArTPCVector())
 {
 }
 
@@ -46,6 +47,14 @@ void StitchingCosmicRayMergingTool::Run(const MasterAlgorithm *const pAlgorithm,
     if (pfoToLArTPCMap.empty())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
+    // ATTN The pfo to tpc map holds the worker instances' own tpcs, not those of the master geometry, so build the graph from these
+    LArTPCVector larTPCVector;
+    pAlgorithm->GetCRWorkerLArTPCs(larTPCVector);
+    std::sort(larTPCVector.begin(), larTPCVector.end(), LArStitchingHelper::SortTPCs);
+
+    if (larTPCVector != m_tpcAdjacencyGraph.GetLArTPCs())
+        m_tpcAdjacencyGraph = LArStitchingHelper::TPCAdjacencyGraph(larTPCVector);
+
     PfoList primaryPfos;
     this->SelectPrimaryPfos(pMultiPfoList, pfoToLArTPCMap, primaryPfos);
 
@@ -56,7 +65,7 @@ void StitchingCosmicRayMergingTool::Run(const MasterAlgorithm *const pAlgorithm,
     this->BuildTPCMaps(primaryPfos, pfoToLArTPCMap, larTPCToPfoMap);
 
     PfoAssociationMatrix pfoAssociationMatrix;
-    this->CreatePfoMatches(larTPCToPfoMap, pointingClusterMap, pfoAssociationMatrix);
+    this->CreatePfoMatches(m_tpcAdjacencyGraph, larTPCToPfoMap, pointingClusterMap, pfoAssociationMatrix);
 
     PfoMergeMap pfoSelectedMatches;
     this->SelectPfoMatches(pfoAssociationMatrix, pfoSelectedMatches);
@@ -67,7 +76,7 @@ void StitchingCosmicRayMergingTool::Run(const MasterAlgorithm *const pAlgorithm,
     PfoMergeMap pfoOrderedMerges;
     this->OrderPfoMerges(pfoToLArTPCMap, pointingClusterMap, pfoSelectedMerges, pfoOrderedMerges);
 
-    this->StitchPfos(pAlgorithm, pointingClusterMap, pfoOrderedMerges, pfoToLArTPCMap);
+    this->StitchPfos(pAlgorithm, m_tpcAdjacencyGraph, pointingClusterMap, pfoOrderedMerges, pfoToLArTPCMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -131,30 +140,63 @@ void StitchingCosmicRayMergingTool::BuildTPCMaps(const PfoList &inputPfoList, co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTPCToPfoMap, const ThreeDPointingClusterMap &pointingClusterMap,
-    PfoAssociationMatrix &pfoAssociationMatrix) const
+void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArStitchingHelper::TPCAdjacencyGraph &tpcAdjacencyGraph, const LArTPCToPfoMap &larTPCToPfoMap,
+    const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const
 {
     LArTPCVector larTPCVector;
     for (const auto &mapEntry : larTPCToPfoMap) larTPCVector.push_back(mapEntry.first);
     std::sort(larTPCVector.begin(), larTPCVector.end(), LArStitchingHelper::SortTPCs);
 
-    for (LArTPCVector::const_iterator tpcIter1 = larTPCVector.begin(), tpcIterEnd = larTPCVector.end(); tpcIter1 != tpcIterEnd; ++tpcIter1)
+    std::unordered_map<const LArTPC*, unsigned int> larTPCToIndexMap;
+    for (unsigned int tpcIndex = 0; tpcIndex < larTPCVector.size(); ++tpcIndex) larTPCToIndexMap[larTPCVector.at(tpcIndex)] = tpcIndex;
+
+    for (unsigned int tpcIndex1 = 0; tpcIndex1 < larTPCVector.size(); ++tpcIndex1)
     {
-        const LArTPC *const pLArTPC1(*tpcIter1);
+        const LArTPC *const pLArTPC1(larTPCVector.at(tpcIndex1));
         const PfoList &pfoList1(larTPCToPfoMap.at(pLArTPC1));
+        const PfoVector pfoVector1(pfoList1.begin(), pfoList1.end());
+
+        // ATTN Only visit the stitchable tpcs later in the sorted list, in the order of that list
+        std::vector<unsigned int> tpcIndices2;
+
+        for (const LArTPC *const pStitchableTPC : tpcAdjacencyGraph.GetStitchableTPCs(*pLArTPC1))
+        {
+            std::unordered_map<const LArTPC*, unsigned int>::const_iterator indexIter(larTPCToIndexMap.find(pStitchableTPC));
+
+            if ((larTPCToIndexMap.end() != indexIter) && (indexIter->second > tpcIndex1))
+                tpcIndices2.push_back(indexIter->second);
+        }
 
-        for (LArTPCVector::const_iterator tpcIter2 = tpcIter1; tpcIter2 != tpcIterEnd; ++tpcIter2)
+        std::sort(tpcIndices2.begin(), tpcIndices2.end());
+
+        for (const unsigned int tpcIndex2 : tpcIndices2)
         {
-            const LArTPC *const pLArTPC2(*tpcIter2);
+            const LArTPC *const pLArTPC2(larTPCVector.at(tpcIndex2));
             const PfoList &pfoList2(larTPCToPfoMap.at(pLArTPC2));
+            const PfoVector pfoVector2(pfoList2.begin(), pfoList2.end());
 
-            if (!LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
-                continue;
+            // Get centre and width of boundary between tpcs
+            const LArStitchingHelper::TPCBoundary &tpcBoundary(tpcAdjacencyGraph.GetTPCBoundary(*pLArTPC1, *pLArTPC2));
+            const float boundaryCenterX(tpcBoundary.m_centerX);
+            const float boundaryWidthX(tpcBoundary.m_widthX);
+            const float maxLongitudinalDisplacementX(m_maxLongitudinalDisplacementX + boundaryWidthX);
+
+            // Only compare Pfos whose vertices lie close enough to each other at the boundary to pass the matching cuts
+            BoundaryVertexVector boundaryVertices1, boundaryVertices2;
+            this->GetBoundaryVertices(*pLArTPC1, *pLArTPC2, true, pfoVector1, pointingClusterMap, boundaryCenterX, maxLongitudinalDisplacementX, boundaryVertices1);
+            this->GetBoundaryVertices(*pLArTPC1, *pLArTPC2, false, pfoVector2, pointingClusterMap, boundaryCenterX, maxLongitudinalDisplacementX, boundaryVertices2);
 
-            for (const ParticleFlowObject *const pPfo1 : pfoList1)
+            CandidateMatchMap candidateMatchMap;
+            this->GetCandidateMatches(boundaryVertices1, boundaryVertices2, maxLongitudinalDisplacementX, candidateMatchMap);
+
+            // ATTN Candidate matches are visited in Pfo list order, as for an exhaustive comparison
+            for (const CandidateMatchMap::value_type &mapEntry : candidateMatchMap)
             {
-                for (const ParticleFlowObject *const pPfo2 : pfoList2)
-                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, pPfo1, pPfo2, pointingClusterMap, pfoAssociationMatrix);
+                for (const unsigned int pfoIndex2 : mapEntry.second)
+                {
+                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, boundaryCenterX, boundaryWidthX, pfoVector1.at(mapEntry.first), pfoVector2.at(pfoIndex2),
+                        pointingClusterMap, pfoAssociationMatrix);
+                }
             }
         }
     }
@@ -162,13 +204,10 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTP
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, const LArTPC &larTPC2,
-    const ParticleFlowObject *const pPfo1, const ParticleFlowObject *const pPfo2,
-    const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const
+void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, const LArTPC &larTPC2, const float boundaryCenterX, const float boundaryWidthX,
+    const ParticleFlowObject *const pPfo1, const ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap,
+    PfoAssociationMatrix &pfoAssociationMatrix) const
 {
-    // Get centre and width of boundary between tpcs
-    const float boundaryCenterX(LArStitchingHelper::GetTPCBoundaryCenterX(larTPC1, larTPC2));
-    const float boundaryWidthX(LArStitchingHelper::GetTPCBoundaryWidthX(larTPC1, larTPC2));
     const float maxLongitudinalDisplacementX(m_maxLongitudinalDisplacementX + boundaryWidthX);
 
     // Get the pointing cluster corresponding to each of these Pfos
@@ -269,6 +308,159 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void StitchingCosmicRayMergingTool::GetBoundaryVertices(const LArTPC &larTPC1, const LArTPC &larTPC2, const bool isFirstTPC, const PfoVector &pfoVector,
+    const ThreeDPointingClusterMap &pointingClusterMap, const float boundaryCenterX, const float maxLongitudinalDisplacementX,
+    BoundaryVertexVector &boundaryVertices) const
+{
+    const float dxVolume(larTPC2.GetCenterX() - larTPC1.GetCenterX());
+    const float maxTransverseDisplacement(std::max(m_maxTransverseDisplacement, m_relaxTransverseDisplacement));
+
+    for (unsigned int pfoIndex = 0; pfoIndex < pfoVector.size(); ++pfoIndex)
+    {
+        ThreeDPointingClusterMap::const_iterator iter(pointingClusterMap.find(pfoVector.at(pfoIndex)));
+
+        if (pointingClusterMap.end() == iter)
+            continue;
+
+        const LArPointingCluster &pointingCluster(iter->second);
+
+        if (pointingCluster.GetLengthSquared() < m_minLengthSquared)
+            continue;
+
+        // ATTN Same choice of vertex as in LArStitchingHelper::GetClosestVertices
+        const float dx(pointingCluster.GetOuterVertex().GetPosition().GetX() - pointingCluster.GetInnerVertex().GetPosition().GetX());
+
+        if (std::fabs(dx) < std::numeric_limits<float>::epsilon())
+            continue;
+
+        const bool useInner(isFirstTPC ? ((dxVolume > 0.f) == (dx < 0.f)) : ((dxVolume > 0.f) == (dx > 0.f)));
+        const LArPointingCluster::Vertex &nearVertex(useInner ? pointingCluster.GetInnerVertex() : pointingCluster.GetOuterVertex());
+        const float pX(std::fabs(nearVertex.GetDirection().GetX()));
+
+        if (pX < std::numeric_limits<float>::epsilon())
+            continue;
+
+        // The longitudinal and transverse impact parameter cuts bound the separation of matched vertices
+        const float minL(-1.f);
+        const float dXdL(m_useXcoordinate ? pX :
+            (1.f - pX * pX > std::numeric_limits<float>::epsilon()) ? pX / std::sqrt(1.f - pX * pX) : minL);
+        const float maxL(std::max(std::fabs(minL), std::fabs(maxLongitudinalDisplacementX / dXdL)));
+        const float searchRadiusYZ(1.01f * std::sqrt(maxL * maxL + maxTransverseDisplacement * maxTransverseDisplacement) + 1.f);
+
+        // ATTN Reflect X for the second tpc, so that the intersection cut becomes a window on the separation in X
+        const CartesianVector &position(nearVertex.GetPosition());
+        const float positionX(isFirstTPC ? position.GetX() : 2.f * boundaryCenterX - position.GetX());
+
+        boundaryVertices.push_back(BoundaryVertex(pfoIndex, CartesianVector(positionX, position.GetY(), position.GetZ()), searchRadiusYZ));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StitchingCosmicRayMergingTool::GetCandidateMatches(const BoundaryVertexVector &boundaryVertices1, const BoundaryVertexVector &boundaryVertices2,
+    const float maxLongitudinalDisplacementX, CandidateMatchMap &candidateMatchMap) const
+{
+    const float maxTransverseDisplacement(std::max(m_maxTransverseDisplacement, m_relaxTransverseDisplacement));
+    const float cellSizeX(std::max(1.f, 1.01f * 2.f * maxLongitudinalDisplacementX + 1.f));
+    const float cellSizeYZ(std::max(1.f, std::sqrt(maxLongitudinalDisplacementX * maxLongitudinalDisplacementX +
+        maxTransverseDisplacement * maxTransverseDisplacement)));
+
+    BoundaryVertexGrid boundaryVertexGrid1, boundaryVertexGrid2;
+    this->FillBoundaryVertexGrid(boundaryVertices1, cellSizeX, cellSizeYZ, boundaryVertexGrid1);
+    this->FillBoundaryVertexGrid(boundaryVertices2, cellSizeX, cellSizeYZ, boundaryVertexGrid2);
+
+    // ATTN Matched vertices lie within the search radius of at least one of the pair, so search from both tpcs
+    std::vector<unsigned int> nearbyIndices;
+
+    for (const BoundaryVertex &boundaryVertex1 : boundaryVertices1)
+    {
+        nearbyIndices.clear();
+        this->GetNearbyBoundaryVertices(boundaryVertex1, boundaryVertices2, boundaryVertexGrid2, cellSizeX, cellSizeYZ, nearbyIndices);
+
+        for (const unsigned int index2 : nearbyIndices)
+            candidateMatchMap[boundaryVertex1.m_pfoIndex].insert(boundaryVertices2.at(index2).m_pfoIndex);
+    }
+
+    for (const BoundaryVertex &boundaryVertex2 : boundaryVertices2)
+    {
+        nearbyIndices.clear();
+        this->GetNearbyBoundaryVertices(boundaryVertex2, boundaryVertices1, boundaryVertexGrid1, cellSizeX, cellSizeYZ, nearbyIndices);
+
+        for (const unsigned int index1 : nearbyIndices)
+            candidateMatchMap[boundaryVertices1.at(index1).m_pfoIndex].insert(boundaryVertex2.m_pfoIndex);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StitchingCosmicRayMergingTool::FillBoundaryVertexGrid(const BoundaryVertexVector &boundaryVertices, const float cellSizeX, const float cellSizeYZ,
+    BoundaryVertexGrid &boundaryVertexGrid) const
+{
+    for (unsigned int index = 0; index < boundaryVertices.size(); ++index)
+    {
+        const CartesianVector &position(boundaryVertices.at(index).m_position);
+        const GridCell gridCell(static_cast<int>(std::floor(position.GetX() / cellSizeX)), static_cast<int>(std::floor(position.GetY() / cellSizeYZ)),
+            static_cast<int>(std::floor(position.GetZ() / cellSizeYZ)));
+
+        boundaryVertexGrid[gridCell].push_back(index);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StitchingCosmicRayMergingTool::GetNearbyBoundaryVertices(const BoundaryVertex &boundaryVertex, const BoundaryVertexVector &boundaryVertices,
+    const BoundaryVertexGrid &boundaryVertexGrid, const float cellSizeX, const float cellSizeYZ, std::vector<unsigned int> &nearbyIndices) const
+{
+    const CartesianVector &position(boundaryVertex.m_position);
+    const float searchRadiusYZ(boundaryVertex.m_searchRadiusYZ);
+    const float nCellsYZ(std::ceil(searchRadiusYZ / cellSizeYZ));
+
+    std::vector<unsigned int> candidateIndices;
+
+    // ATTN Vertices pointing almost parallel to the boundary (small dX/dL) have a wide search window, so check every vertex
+    if (!(3.f * (2.f * nCellsYZ + 1.f) * (2.f * nCellsYZ + 1.f) < static_cast<float>(boundaryVertexGrid.size())))
+    {
+        for (unsigned int index = 0; index < boundaryVertices.size(); ++index)
+            candidateIndices.push_back(index);
+    }
+    else
+    {
+        const int cellX(static_cast<int>(std::floor(position.GetX() / cellSizeX)));
+        const int cellY(static_cast<int>(std::floor(position.GetY() / cellSizeYZ)));
+        const int cellZ(static_cast<int>(std::floor(position.GetZ() / cellSizeYZ)));
+        const int nCells(static_cast<int>(nCellsYZ));
+
+        for (int iX = cellX - 1; iX <= cellX + 1; ++iX)
+        {
+            for (int iY = cellY - nCells; iY <= cellY + nCells; ++iY)
+            {
+                for (int iZ = cellZ - nCells; iZ <= cellZ + nCells; ++iZ)
+                {
+                    BoundaryVertexGrid::const_iterator gridIter(boundaryVertexGrid.find(GridCell(iX, iY, iZ)));
+
+                    if (boundaryVertexGrid.end() != gridIter)
+                        candidateIndices.insert(candidateIndices.end(), gridIter->second.begin(), gridIter->second.end());
+                }
+            }
+        }
+    }
+
+    for (const unsigned int index : candidateIndices)
+    {
+        const CartesianVector &otherPosition(boundaryVertices.at(index).m_position);
+        const float deltaX(otherPosition.GetX() - position.GetX());
+        const float deltaY(otherPosition.GetY() - position.GetY());
+        const float deltaZ(otherPosition.GetZ() - position.GetZ());
+
+        if ((std::fabs(deltaX) > cellSizeX) || (deltaY * deltaY + deltaZ * deltaZ > searchRadiusYZ * searchRadiusYZ))
+            continue;
+
+        nearbyIndices.push_back(index);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void StitchingCosmicRayMergingTool::SelectPfoMatches(const PfoAssociationMatrix &pfoAssociationMatrix, PfoMergeMap &pfoMatches) const
 {
     // First step: loop over association matrix and find best associations A -> X and B -> Y
@@ -509,8 +701,8 @@ void StitchingCosmicRayMergingTool::OrderPfoMerges(const PfoToLArTPCMap &pfoToLA
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void StitchingCosmicRayMergingTool::StitchPfos(const MasterAlgorithm *const pAlgorithm, const ThreeDPointingClusterMap &pointingClusterMap,
-    const PfoMergeMap &pfoMerges, PfoToLArTPCMap &pfoToLArTPCMap) const
+void StitchingCosmicRayMergingTool::StitchPfos(const MasterAlgorithm *const pAlgorithm, const LArStitchingHelper::TPCAdjacencyGraph &tpcAdjacencyGraph,
+    const ThreeDPointingClusterMap &pointingClusterMap, const PfoMergeMap &pfoMerges, PfoToLArTPCMap &pfoToLArTPCMap) const
 {
     PfoVector pfoVectorToEnlarge;
     for (const auto &mapEntry : pfoMerges) pfoVectorToEnlarge.push_back(mapEntry.first);
@@ -530,7 +722,7 @@ void StitchingCosmicRayMergingTool::StitchPfos(const MasterAlgorithm *const pAlg
 
             try
             {
-                this->CalculateX0(pfoToLArTPCMap, pointingClusterMap, pfoVector, x0);
+                this->CalculateX0(tpcAdjacencyGraph, pfoToLArTPCMap, pointingClusterMap, pfoVector, x0);
             }
             catch (const pandora::StatusCodeException &)
             {
@@ -553,8 +745,8 @@ void StitchingCosmicRayMergingTool::StitchPfos(const MasterAlgorithm *const pAlg
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void StitchingCosmicRayMergingTool::CalculateX0(const PfoToLArTPCMap &pfoToLArTPCMap, const ThreeDPointingClusterMap &pointingClusterMap,
-    const PfoVector &pfoVector, float &x0) const
+void StitchingCosmicRayMergingTool::CalculateX0(const LArStitchingHelper::TPCAdjacencyGraph &tpcAdjacencyGraph, const PfoToLArTPCMap &pfoToLArTPCMap,
+    const ThreeDPointingClusterMap &pointingClusterMap, const PfoVector &pfoVector, float &x0) const
 {
     float sumX(0.f), sumN(0.f);
 
@@ -582,7 +774,7 @@ void StitchingCosmicRayMergingTool::CalculateX0(const PfoToLArTPCMap &pfoToLArTP
             const LArTPC *const pLArTPC2(tpcIter2->second);
             const LArPointingCluster &pointingCluster2(pointingIter2->second);
 
-            if (!LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
+            if (!tpcAdjacencyGraph.CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
                 continue;
 
             // Calculate X0 for the closest pair of vertices
@@ -640,6 +832,16 @@ float StitchingCosmicRayMergingTool::PfoAssociation::GetFigureOfMerit() const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StitchingCosmicRayMergingTool::BoundaryVertex::BoundaryVertex(const unsigned int pfoIndex, const CartesianVector &position, const float searchRadiusYZ) :
+    m_pfoIndex(pfoIndex),
+    m_position(position),
+    m_searchRadiusYZ(searchRadiusYZ)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode StitchingCosmicRayMergingTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -10,10 +10,16 @@
 
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
+
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include <map>
+#include <set>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -123,25 +129,105 @@ private:
     /**
      *  @brief  Create associations between Pfos using 3D pointing clusters
      *
+     *  @param  tpcAdjacencyGraph the adjacency graph of the tpcs in the input mapping
      *  @param  larTPCToPfoMap the input mapping between tpc and Pfos
      *  @param  pointingClusterMap the mapping between Pfos and their corresponding 3D pointing clusters
      *  @param  pfoAssociationMatrix the output matrix of associations between Pfos
      */
-    void CreatePfoMatches(const LArTPCToPfoMap &larTPCToPfoMap, const ThreeDPointingClusterMap &pointingClusterMap,
-        PfoAssociationMatrix &pfoAssociationMatrix) const;
+    void CreatePfoMatches(const LArStitchingHelper::TPCAdjacencyGraph &tpcAdjacencyGraph, const LArTPCToPfoMap &larTPCToPfoMap,
+        const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const;
 
     /**
      *  @brief  Create associations between Pfos using 3D pointing clusters
      *
      *  @param  larTPC1 the tpc description for the first Pfo
      *  @param  larTPC2 the tpc description for the second Pfo
+     *  @param  boundaryCenterX the centre in X of the boundary between the tpcs
+     *  @param  boundaryWidthX the width in X of the boundary between the tpcs
      *  @param  pPfo1 the first Pfo
      *  @param  pPfo2 the second Pfo
      *  @param  pointingClusterMap the mapping between Pfos and their corresponding 3D pointing clusters
      *  @param  pfoAssociationMatrix the output matrix of associations between Pfos
      */
-    void CreatePfoMatches(const pandora::LArTPC &larTPC1, const pandora::LArTPC &larTPC2, const pandora::ParticleFlowObject *const pPfo1,
-        const pandora::ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const;
+    void CreatePfoMatches(const pandora::LArTPC &larTPC1, const pandora::LArTPC &larTPC2, const float boundaryCenterX, const float boundaryWidthX,
+        const pandora::ParticleFlowObject *const pPfo1, const pandora::ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap,
+        PfoAssociationMatrix &pfoAssociationMatrix) const;
+
+    /**
+     *  @brief  BoundaryVertex class, the vertex of a Pfo closest to the boundary between a pair of tpcs
+     */
+    class BoundaryVertex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pfoIndex the index of the Pfo in its tpc Pfo list
+         *  @param  position the vertex position, with X reflected about the boundary for the second tpc
+         *  @param  searchRadiusYZ the maximum yz separation from a vertex in the other tpc that could pass the matching cuts
+         */
+        BoundaryVertex(const unsigned int pfoIndex, const pandora::CartesianVector &position, const float searchRadiusYZ);
+
+        unsigned int                m_pfoIndex;         ///< The index of the Pfo in its tpc Pfo list
+        pandora::CartesianVector    m_position;         ///< The vertex position, with X reflected about the boundary for the second tpc
+        float                       m_searchRadiusYZ;   ///< The maximum yz separation from a vertex in the other tpc that could pass the matching cuts
+    };
+
+    typedef std::vector<BoundaryVertex> BoundaryVertexVector;
+    typedef std::tuple<int, int, int> GridCell;
+    typedef std::map<GridCell, std::vector<unsigned int>> BoundaryVertexGrid;
+    typedef std::map<unsigned int, std::set<unsigned int>> CandidateMatchMap;
+
+    /**
+     *  @brief  Get the vertices closest to the boundary between a pair of tpcs, for the Pfos in one of the tpcs
+     *
+     *  @param  larTPC1 the first tpc
+     *  @param  larTPC2 the second tpc
+     *  @param  isFirstTPC whether the Pfos belong to the first tpc
+     *  @param  pfoVector the Pfos in the relevant tpc
+     *  @param  pointingClusterMap the mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  boundaryCenterX the centre in X of the boundary between the tpcs
+     *  @param  maxLongitudinalDisplacementX the maximum longitudinal displacement in X for the pair of tpcs
+     *  @param  boundaryVertices to receive the boundary vertices of Pfos that could pass the matching cuts
+     */
+    void GetBoundaryVertices(const pandora::LArTPC &larTPC1, const pandora::LArTPC &larTPC2, const bool isFirstTPC, const pandora::PfoVector &pfoVector,
+        const ThreeDPointingClusterMap &pointingClusterMap, const float boundaryCenterX, const float maxLongitudinalDisplacementX,
+        BoundaryVertexVector &boundaryVertices) const;
+
+    /**
+     *  @brief  Find the pairs of Pfos, from a pair of tpcs, with boundary vertices close enough to pass the matching cuts
+     *
+     *  @param  boundaryVertices1 the boundary vertices for the first tpc
+     *  @param  boundaryVertices2 the boundary vertices for the second tpc
+     *  @param  maxLongitudinalDisplacementX the maximum longitudinal displacement in X for the pair of tpcs
+     *  @param  candidateMatchMap to receive the mapping from Pfo indices in the first tpc to candidate Pfo indices in the second tpc
+     */
+    void GetCandidateMatches(const BoundaryVertexVector &boundaryVertices1, const BoundaryVertexVector &boundaryVertices2,
+        const float maxLongitudinalDisplacementX, CandidateMatchMap &candidateMatchMap) const;
+
+    /**
+     *  @brief  Index boundary vertices in a grid of cells in X and (y,z)
+     *
+     *  @param  boundaryVertices the boundary vertices
+     *  @param  cellSizeX the cell size in X
+     *  @param  cellSizeYZ the cell size in y and z
+     *  @param  boundaryVertexGrid to receive the grid of boundary vertex indices
+     */
+    void FillBoundaryVertexGrid(const BoundaryVertexVector &boundaryVertices, const float cellSizeX, const float cellSizeYZ,
+        BoundaryVertexGrid &boundaryVertexGrid) const;
+
+    /**
+     *  @brief  Collect the boundary vertices in a grid that are within the search window of a given boundary vertex
+     *
+     *  @param  boundaryVertex the boundary vertex
+     *  @param  boundaryVertices the boundary vertices indexed by the grid
+     *  @param  boundaryVertexGrid the grid of boundary vertex indices
+     *  @param  cellSizeX the cell size in X, also the search window in X
+     *  @param  cellSizeYZ the cell size in y and z
+     *  @param  nearbyIndices to receive the indices of the nearby boundary vertices
+     */
+    void GetNearbyBoundaryVertices(const BoundaryVertex &boundaryVertex, const BoundaryVertexVector &boundaryVertices,
+        const BoundaryVertexGrid &boundaryVertexGrid, const float cellSizeX, const float cellSizeYZ, std::vector<unsigned int> &nearbyIndices) const;
 
     typedef std::unordered_map<const pandora::ParticleFlowObject*, pandora::PfoList> PfoMergeMap;
 
@@ -188,23 +274,25 @@ private:
      *  @brief  Apply X0 corrections, and then stitch together Pfos
      *
      *  @param  pAlgorithm the address of the parent stitching algorithm
+     *  @param  tpcAdjacencyGraph the adjacency graph of the tpcs in the pfo to lar tpc map
      *  @param  pointingClusterMap  the mapping between Pfos and their corresponding 3D pointing clusters
      *  @param  pfoMerges the input map of Pfo merges
      *  @param  pfoToLArTPCMap the pfo to lar tpc map
      */
-    void StitchPfos(const MasterAlgorithm *const pAlgorithm, const ThreeDPointingClusterMap &pointingClusterMap,
-        const PfoMergeMap &pfoMerges, PfoToLArTPCMap &pfoToLArTPCMap) const;
+    void StitchPfos(const MasterAlgorithm *const pAlgorithm, const LArStitchingHelper::TPCAdjacencyGraph &tpcAdjacencyGraph,
+        const ThreeDPointingClusterMap &pointingClusterMap, const PfoMergeMap &pfoMerges, PfoToLArTPCMap &pfoToLArTPCMap) const;
 
     /**
      *  @brief  Calculate x0 shift for a group of associated Pfos
      *
+     *  @param  tpcAdjacencyGraph the adjacency graph of the tpcs in the mapping between pfos and tpc
      *  @param  pfoToLArTPCMap the mapping between pfos and tpc
      *  @param  pointingClusterMap the mapping between Pfos and their corresponding 3D pointing clusters
      *  @param  pfoVector the vector of parent Pfos to stitch together
      *  @param  x0 the output x0 value
      */
-    void CalculateX0(const PfoToLArTPCMap &pfoToLArTPCMap, const ThreeDPointingClusterMap &pointingClusterMap,
-        const pandora::PfoVector &pfoVector, float &x0) const;
+    void CalculateX0(const LArStitchingHelper::TPCAdjacencyGraph &tpcAdjacencyGraph, const PfoToLArTPCMap &pfoToLArTPCMap,
+        const ThreeDPointingClusterMap &pointingClusterMap, const pandora::PfoVector &pfoVector, float &x0) const;
 
     bool  m_useXcoordinate;
     int   m_halfWindowLayers;
@@ -214,6 +302,8 @@ private:
     float m_maxTransverseDisplacement;
     float m_relaxCosRelativeAngle;
     float m_relaxTransverseDisplacement;
+
+    LArStitchingHelper::TPCAdjacencyGraph   m_tpcAdjacencyGraph;    ///< The tpc adjacency graph, built for the tpcs of the worker instances
 };
 
 } // namespace lar_content
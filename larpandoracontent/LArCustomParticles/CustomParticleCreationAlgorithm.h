@@ -30,6 +30,13 @@ protected:
      */
     virtual void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject*& pOutputPfo) const = 0;
 
+    /**
+     *  @brief  Prepare for creation of specialised Pfos, called once per event before any input Pfo is replaced
+     *
+     *  @param  pfoList the list of input Pfos, in the order in which they will be passed to CreatePfo
+     */
+    virtual void PrepareInputPfos(const pandora::PfoList &pfoList);
+
 private:
     std::string  m_pfoListName;      ///< The name of the input pfo list
     std::string  m_vertexListName;   ///< The name of the input vertex list
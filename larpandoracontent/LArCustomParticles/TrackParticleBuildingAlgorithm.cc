@@ -17,15 +17,63 @@
 
 #include "larpandoracontent/LArCustomParticles/TrackParticleBuildingAlgorithm.h"
 
+#include <algorithm>
+#include <thread>
+#include <utility>
+
 using namespace pandora;
 
 namespace lar_content
 {
 
 TrackParticleBuildingAlgorithm::TrackParticleBuildingAlgorithm() :
-    m_slidingFitHalfWindow(20)
+    m_slidingFitHalfWindow(20),
+    m_nTrajectoryThreads(0)
+{
+
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackParticleBuildingAlgorithm::PrepareInputPfos(const PfoList &pfoList)
 {
+    m_trajectoryMap.clear();
+
+    if (0 == m_nTrajectoryThreads)
+        return;
+
+    PfoVector pfoVector;
+
+    for (const ParticleFlowObject *const pInputPfo : pfoList)
+    {
+        if (!pInputPfo->GetVertexList().empty() && this->IsTrackCandidate(pInputPfo))
+            pfoVector.push_back(pInputPfo);
+    }
+
+    if (pfoVector.empty())
+        return;
+
+    // ATTN Workers only read the pfo hits and vertex, which are unchanged until CreatePfo is called for that pfo
+    const float layerPitch(this->GetLayerPitch());
+    TrajectoryVector trajectoryVector(pfoVector.size());
+    std::atomic<unsigned int> nextIndex(0);
+    const unsigned int nThreads(std::min(m_nTrajectoryThreads, static_cast<unsigned int>(pfoVector.size())));
 
+    std::vector<std::thread> threadVector;
+
+    for (unsigned int iThread = 1; iThread < nThreads; ++iThread)
+    {
+        threadVector.push_back(std::thread(&TrackParticleBuildingAlgorithm::GetTrajectoriesWorker, this, layerPitch, &pfoVector, &nextIndex,
+            &trajectoryVector));
+    }
+
+    TrackParticleBuildingAlgorithm::GetTrajectoriesWorker(this, layerPitch, &pfoVector, &nextIndex, &trajectoryVector);
+
+    for (std::thread &thread : threadVector)
+        thread.join();
+
+    for (unsigned int iPfo = 0; iPfo < pfoVector.size(); ++iPfo)
+        m_trajectoryMap[pfoVector.at(iPfo)] = std::move(trajectoryVector.at(iPfo));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -37,29 +85,25 @@ void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const p
         // Need an input vertex to provide a track propagation direction
         const Vertex *const pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
 
-        // In cosmic mode, build tracks from all parent pfos, otherwise require that pfo is track-like
-        if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
+        if (!this->IsTrackCandidate(pInputPfo))
+            return;
+
+        // Calculate sliding fit trajectory, unless already calculated in advance
+        LArTrackStateVector trackStateVector;
+        TrajectoryMap::const_iterator trajectoryIter(m_trajectoryMap.find(pInputPfo));
+
+        if (m_trajectoryMap.end() != trajectoryIter)
         {
-            if (!LArPfoHelper::IsTrack(pInputPfo))
-                return;
+            if (trajectoryIter->second.m_exceptionPtr)
+                std::rethrow_exception(trajectoryIter->second.m_exceptionPtr);
+
+            trackStateVector = trajectoryIter->second.m_trackStateVector;
         }
         else
         {
-            if (!LArPfoHelper::IsFinalState(pInputPfo))
-                return;
-
-            if (LArPfoHelper::IsNeutrino(pInputPfo))
-                return;
+            LArPfoHelper::GetSlidingFitTrajectory(pInputPfo, pInputVertex, m_slidingFitHalfWindow, this->GetLayerPitch(), trackStateVector);
         }
 
-        // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
-        const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
-        const float layerPitch(pFirstLArTPC->GetWirePitchW());
-
-        // Calculate sliding fit trajectory
-        LArTrackStateVector trackStateVector;
-        LArPfoHelper::GetSlidingFitTrajectory(pInputPfo, pInputVertex, m_slidingFitHalfWindow, layerPitch, trackStateVector);
-
         if (trackStateVector.empty())
             return;
 
@@ -104,11 +148,62 @@ void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const p
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool TrackParticleBuildingAlgorithm::IsTrackCandidate(const ParticleFlowObject *const pInputPfo) const
+{
+    // In cosmic mode, build tracks from all parent pfos, otherwise require that pfo is track-like
+    if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
+        return LArPfoHelper::IsTrack(pInputPfo);
+
+    if (!LArPfoHelper::IsFinalState(pInputPfo))
+        return false;
+
+    return !LArPfoHelper::IsNeutrino(pInputPfo);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float TrackParticleBuildingAlgorithm::GetLayerPitch() const
+{
+    // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
+    const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
+    return pFirstLArTPC->GetWirePitchW();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackParticleBuildingAlgorithm::GetTrajectoriesWorker(const TrackParticleBuildingAlgorithm *const pAlgorithm, const float layerPitch,
+    const PfoVector *const pPfoVector, std::atomic<unsigned int> *const pNextIndex, TrajectoryVector *const pTrajectoryVector)
+{
+    // One set of scratch buffers per thread, reused for every pfo this thread processes
+    LArPfoHelper::SlidingFitTrajectoryBuffers buffers;
+
+    for (unsigned int iPfo = (*pNextIndex)++; iPfo < pPfoVector->size(); iPfo = (*pNextIndex)++)
+    {
+        const ParticleFlowObject *const pInputPfo(pPfoVector->at(iPfo));
+        Trajectory &trajectory(pTrajectoryVector->at(iPfo));
+
+        try
+        {
+            LArPfoHelper::GetSlidingFitTrajectory(pInputPfo, LArPfoHelper::GetVertex(pInputPfo), pAlgorithm->m_slidingFitHalfWindow, layerPitch,
+                buffers, trajectory.m_trackStateVector);
+        }
+        catch (...)
+        {
+            trajectory.m_exceptionPtr = std::current_exception();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackParticleBuildingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "SlidingFitHalfWindow", m_slidingFitHalfWindow));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NTrajectoryThreads", m_nTrajectoryThreads));
+
     return CustomParticleCreationAlgorithm::ReadSettings(xmlHandle);
 }
 
@@ -12,6 +12,11 @@
 
 #include "larpandoracontent/LArCustomParticles/CustomParticleCreationAlgorithm.h"
 
+#include <atomic>
+#include <exception>
+#include <unordered_map>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -27,11 +32,55 @@ public:
     TrackParticleBuildingAlgorithm();
 
 private:
+    /**
+     *  @brief  Trajectory class, the sliding fit trajectory calculated in advance for a single input pfo
+     */
+    class Trajectory
+    {
+    public:
+        LArTrackStateVector     m_trackStateVector;     ///< The track trajectory
+        std::exception_ptr      m_exceptionPtr;         ///< The exception raised whilst calculating the trajectory, if any
+    };
+
+    typedef std::vector<Trajectory> TrajectoryVector;
+    typedef std::unordered_map<const pandora::ParticleFlowObject*, Trajectory> TrajectoryMap;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    void PrepareInputPfos(const pandora::PfoList &pfoList);
     void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject*& pOutputPfo) const;
 
+    /**
+     *  @brief  Whether a track should be built from an input pfo
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *
+     *  @return boolean
+     */
+    bool IsTrackCandidate(const pandora::ParticleFlowObject *const pInputPfo) const;
+
+    /**
+     *  @brief  Get the layer pitch to use for the sliding fit
+     *
+     *  @return the layer pitch
+     */
+    float GetLayerPitch() const;
+
+    /**
+     *  @brief  Worker thread function, taking pfos from a shared index until the pfo vector is exhausted
+     *
+     *  @param  pAlgorithm address of the track particle building algorithm
+     *  @param  layerPitch the layer pitch to use for the sliding fit
+     *  @param  pPfoVector address of the vector of input pfos
+     *  @param  pNextIndex address of the shared index of the next pfo to process
+     *  @param  pTrajectoryVector address of the vector to receive the trajectories, with one entry per input pfo
+     */
+    static void GetTrajectoriesWorker(const TrackParticleBuildingAlgorithm *const pAlgorithm, const float layerPitch,
+        const pandora::PfoVector *const pPfoVector, std::atomic<unsigned int> *const pNextIndex, TrajectoryVector *const pTrajectoryVector);
+
     unsigned int    m_slidingFitHalfWindow;   ///<
+    unsigned int    m_nTrajectoryThreads;     ///< The number of threads with which to calculate trajectories in advance - if zero, run serially
+    TrajectoryMap   m_trajectoryMap;          ///< The trajectories calculated in advance for the current event
 };
 
 } // namespace lar_content
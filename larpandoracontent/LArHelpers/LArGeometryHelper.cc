@@ -23,6 +23,8 @@
 
 #include "Plugins/LArTransformationPlugin.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -414,6 +416,60 @@ bool LArGeometryHelper::IsXSamplingPointInGap(const Pandora &pandora, const floa
     const float gapTolerance)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(slidingFitResult.GetCluster()));
+    return LArGeometryHelper::IsInGap(pandora, LArGeometryHelper::GetXSamplingPoint(xSample, slidingFitResult), hitType, gapTolerance);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArGeometryHelper::IsXSamplingPointInGap(const DetectorGapIndex &detectorGapIndex, const float xSample, const TwoDSlidingFitResult &slidingFitResult,
+    const float gapTolerance)
+{
+    const HitType hitType(LArClusterHelper::GetClusterHitType(slidingFitResult.GetCluster()));
+    return detectorGapIndex.IsInGap(LArGeometryHelper::GetXSamplingPoint(xSample, slidingFitResult), hitType, gapTolerance);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const float minZ, const float maxZ, const HitType hitType)
+{
+    if (maxZ - minZ < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    float gapDeltaZ(0.f);
+
+    for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
+    {
+        const LineGap *const pLineGap = dynamic_cast<const LineGap*>(pDetectorGap);
+
+        if (!pLineGap)
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        const LineGapType lineGapType(pLineGap->GetLineGapType());
+
+        if (!(((TPC_VIEW_U == hitType) && (TPC_WIRE_GAP_VIEW_U == lineGapType)) ||
+              ((TPC_VIEW_V == hitType) && (TPC_WIRE_GAP_VIEW_V == lineGapType)) ||
+              ((TPC_VIEW_W == hitType) && (TPC_WIRE_GAP_VIEW_W == lineGapType))))
+        {
+            continue;
+        }
+
+        if ((pLineGap->GetLineStartZ() > maxZ) || (pLineGap->GetLineEndZ() < minZ))
+            continue;
+
+        const float gapMinZ(std::max(minZ, pLineGap->GetLineStartZ()));
+        const float gapMaxZ(std::min(maxZ, pLineGap->GetLineEndZ()));
+
+        if ((gapMaxZ - gapMinZ) > std::numeric_limits<float>::epsilon())
+            gapDeltaZ += (gapMaxZ - gapMinZ);
+    }
+
+    return gapDeltaZ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector LArGeometryHelper::GetXSamplingPoint(const float xSample, const TwoDSlidingFitResult &slidingFitResult)
+{
     const CartesianVector minLayerPosition(slidingFitResult.GetGlobalMinLayerPosition());
     const CartesianVector maxLayerPosition(slidingFitResult.GetGlobalMaxLayerPosition());
 
@@ -426,7 +482,7 @@ bool LArGeometryHelper::IsXSamplingPointInGap(const Pandora &pandora, const floa
         CartesianVector slidingFitPosition(0.f, 0.f, 0.f);
 
         if (STATUS_CODE_SUCCESS == slidingFitResult.GetGlobalFitPositionAtX(xSample, slidingFitPosition))
-            return (LArGeometryHelper::IsInGap(pandora, slidingFitPosition, hitType, gapTolerance));
+            return slidingFitPosition;
     }
 
     const CartesianVector lowXDirection(minLayerIsAtLowX ? slidingFitResult.GetGlobalMinLayerDirection() : slidingFitResult.GetGlobalMaxLayerDirection());
@@ -440,41 +496,126 @@ bool LArGeometryHelper::IsXSamplingPointInGap(const Pandora &pandora, const floa
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
     const float pathLength((xSample - startPosition.GetX()) / startDirection.GetX());
-    const CartesianVector samplingPoint(startPosition + startDirection * pathLength);
+    return (startPosition + startDirection * pathLength);
+}
 
-    return (LArGeometryHelper::IsInGap(pandora, samplingPoint, hitType, gapTolerance));
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::DetectorGapIndex::DetectorGapIndex(const DetectorGapList &detectorGapList) :
+    m_onlyLineGaps(true)
+{
+    unsigned int gapIndex(0);
+
+    for (const DetectorGap *const pDetectorGap : detectorGapList)
+    {
+        const LineGap *const pLineGap(dynamic_cast<const LineGap*>(pDetectorGap));
+        const BoxGap *const pBoxGap(pLineGap ? nullptr : dynamic_cast<const BoxGap*>(pDetectorGap));
+
+        if (pLineGap)
+        {
+            const GapInterval gapInterval(pDetectorGap, gapIndex, pLineGap->GetLineStartZ(), pLineGap->GetLineEndZ());
+            const LineGapType lineGapType(pLineGap->GetLineGapType());
+
+            if (TPC_WIRE_GAP_VIEW_U == lineGapType)
+            {
+                m_lineGapsU.push_back(gapInterval);
+            }
+            else if (TPC_WIRE_GAP_VIEW_V == lineGapType)
+            {
+                m_lineGapsV.push_back(gapInterval);
+            }
+            else if (TPC_WIRE_GAP_VIEW_W == lineGapType)
+            {
+                m_lineGapsW.push_back(gapInterval);
+            }
+            else
+            {
+                m_otherGaps.push_back(pDetectorGap);
+                ++gapIndex;
+                continue;
+            }
+
+            m_lineGapsAll.push_back(gapInterval);
+        }
+        else if (pBoxGap)
+        {
+            m_onlyLineGaps = false;
+            const CartesianVector &vertex(pBoxGap->GetVertex());
+            const float sideZ1(pBoxGap->GetSide1().GetZ()), sideZ2(pBoxGap->GetSide2().GetZ()), sideZ3(pBoxGap->GetSide3().GetZ());
+            const float minZ(vertex.GetZ() + std::min(0.f, sideZ1) + std::min(0.f, sideZ2) + std::min(0.f, sideZ3));
+            const float maxZ(vertex.GetZ() + std::max(0.f, sideZ1) + std::max(0.f, sideZ2) + std::max(0.f, sideZ3));
+            m_boxGaps.push_back(GapInterval(pDetectorGap, gapIndex, minZ, maxZ));
+        }
+        else
+        {
+            m_onlyLineGaps = false;
+            m_otherGaps.push_back(pDetectorGap);
+        }
+
+        ++gapIndex;
+    }
+
+    for (GapIntervalVector *const pGapIntervals : {&m_lineGapsU, &m_lineGapsV, &m_lineGapsW, &m_lineGapsAll, &m_boxGaps})
+        DetectorGapIndex::SortIntervals(*pGapIntervals);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const float minZ, const float maxZ, const HitType hitType)
+bool LArGeometryHelper::DetectorGapIndex::IsInGap(const CartesianVector &testPoint2D, const HitType hitType, const float gapTolerance) const
 {
-    if (maxZ - minZ < std::numeric_limits<float>::epsilon())
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    // ATTN The index only selects candidate gaps, with a margin for rounding; the decision is always made by the gap itself
+    const float margin(0.01f);
+    const float testZ(testPoint2D.GetZ());
+    const float lineGapWindow(std::fabs(gapTolerance) + margin);
+    const float boxGapWindow(2.f * std::fabs(gapTolerance) + margin);
 
-    float gapDeltaZ(0.f);
+    GapIntervalList candidateIntervals;
+    DetectorGapIndex::GetOverlappingIntervals(this->GetLineGapIntervals(hitType), testZ - lineGapWindow, testZ + lineGapWindow, candidateIntervals);
+    DetectorGapIndex::GetOverlappingIntervals(m_boxGaps, testZ - boxGapWindow, testZ + boxGapWindow, candidateIntervals);
 
-    for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
+    for (const GapInterval *const pGapInterval : candidateIntervals)
     {
-        const LineGap *const pLineGap = dynamic_cast<const LineGap*>(pDetectorGap);
+        if (pGapInterval->m_pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
+            return true;
+    }
 
-        if (!pLineGap)
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    for (const DetectorGap *const pDetectorGap : m_otherGaps)
+    {
+        if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
+            return true;
+    }
 
-        const LineGapType lineGapType(pLineGap->GetLineGapType());
+    return false;
+}
 
-        if (!(((TPC_VIEW_U == hitType) && (TPC_WIRE_GAP_VIEW_U == lineGapType)) ||
-              ((TPC_VIEW_V == hitType) && (TPC_WIRE_GAP_VIEW_V == lineGapType)) ||
-              ((TPC_VIEW_W == hitType) && (TPC_WIRE_GAP_VIEW_W == lineGapType))))
-        {
-            continue;
-        }
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        if ((pLineGap->GetLineStartZ() > maxZ) || (pLineGap->GetLineEndZ() < minZ))
+float LArGeometryHelper::DetectorGapIndex::CalculateGapDeltaZ(const float minZ, const float maxZ, const HitType hitType) const
+{
+    if ((maxZ - minZ < std::numeric_limits<float>::epsilon()) || !m_onlyLineGaps)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
+        return 0.f;
+
+    const float margin(0.01f);
+    GapIntervalList candidateIntervals;
+    DetectorGapIndex::GetOverlappingIntervals(this->GetLineGapIntervals(hitType), minZ - margin, maxZ + margin, candidateIntervals);
+
+    // ATTN Sum the gap lengths in detector gap list order, for reproducibility
+    std::sort(candidateIntervals.begin(), candidateIntervals.end(),
+        [](const GapInterval *const pLhs, const GapInterval *const pRhs) -> bool {return (pLhs->m_gapIndex < pRhs->m_gapIndex);});
+
+    float gapDeltaZ(0.f);
+
+    for (const GapInterval *const pGapInterval : candidateIntervals)
+    {
+        if ((pGapInterval->m_minZ > maxZ) || (pGapInterval->m_maxZ < minZ))
             continue;
 
-        const float gapMinZ(std::max(minZ, pLineGap->GetLineStartZ()));
-        const float gapMaxZ(std::min(maxZ, pLineGap->GetLineEndZ()));
+        const float gapMinZ(std::max(minZ, pGapInterval->m_minZ));
+        const float gapMaxZ(std::min(maxZ, pGapInterval->m_maxZ));
 
         if ((gapMaxZ - gapMinZ) > std::numeric_limits<float>::epsilon())
             gapDeltaZ += (gapMaxZ - gapMinZ);
@@ -483,4 +624,70 @@ float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const float
     return gapDeltaZ;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::DetectorGapIndex::SortIntervals(GapIntervalVector &gapIntervals)
+{
+    std::sort(gapIntervals.begin(), gapIntervals.end(), [](const GapInterval &lhs, const GapInterval &rhs) -> bool
+        {return ((lhs.m_minZ < rhs.m_minZ) || (!(rhs.m_minZ < lhs.m_minZ) && (lhs.m_gapIndex < rhs.m_gapIndex)));});
+
+    float runningMaxZ(-std::numeric_limits<float>::max());
+
+    for (GapInterval &gapInterval : gapIntervals)
+    {
+        runningMaxZ = std::max(runningMaxZ, gapInterval.m_maxZ);
+        gapInterval.m_runningMaxZ = runningMaxZ;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::DetectorGapIndex::GetOverlappingIntervals(const GapIntervalVector &gapIntervals, const float minZ, const float maxZ,
+    GapIntervalList &overlappingIntervals)
+{
+    // Intervals starting beyond maxZ cannot overlap; walk back from there until no earlier interval can reach minZ
+    GapIntervalVector::const_iterator iter(std::upper_bound(gapIntervals.begin(), gapIntervals.end(), maxZ,
+        [](const float value, const GapInterval &gapInterval) -> bool {return (value < gapInterval.m_minZ);}));
+
+    while (gapIntervals.begin() != iter)
+    {
+        --iter;
+
+        if (iter->m_runningMaxZ < minZ)
+            break;
+
+        if (iter->m_maxZ >= minZ)
+            overlappingIntervals.push_back(&(*iter));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArGeometryHelper::DetectorGapIndex::GapIntervalVector &LArGeometryHelper::DetectorGapIndex::GetLineGapIntervals(const HitType hitType) const
+{
+    if (TPC_VIEW_U == hitType)
+        return m_lineGapsU;
+
+    if (TPC_VIEW_V == hitType)
+        return m_lineGapsV;
+
+    if (TPC_VIEW_W == hitType)
+        return m_lineGapsW;
+
+    return m_lineGapsAll;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::DetectorGapIndex::GapInterval::GapInterval(const DetectorGap *const pDetectorGap, const unsigned int gapIndex, const float minZ,
+    const float maxZ) :
+    m_pDetectorGap(pDetectorGap),
+    m_gapIndex(gapIndex),
+    m_minZ(minZ),
+    m_maxZ(maxZ),
+    m_runningMaxZ(maxZ)
+{
+}
+
 } // namespace lar_content
@@ -9,11 +9,13 @@
 #define LAR_GEOMETRY_HELPER_H 1
 
 #include "Pandora/PandoraEnumeratedTypes.h"
+#include "Pandora/PandoraInternal.h"
 #include "Pandora/StatusCodes.h"
 
 #include <unordered_map>
+#include <vector>
 
-namespace pandora {class CartesianVector; class Pandora;}
+namespace pandora {class CartesianVector; class DetectorGap; class Pandora;}
 
 namespace lar_content
 {
@@ -28,6 +30,105 @@ class TwoDSlidingFitResult;
 class LArGeometryHelper
 {
 public:
+    /**
+     *  @brief  DetectorGapIndex class, an index of the registered detector gaps ordered by their extent in z. The index holds the addresses
+     *          of the gaps, so is built by the calling algorithm from the gap list of its own pandora instance, typically once per event.
+     */
+    class DetectorGapIndex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  detectorGapList the list of registered detector gaps
+         */
+        DetectorGapIndex(const pandora::DetectorGapList &detectorGapList);
+
+        /**
+         *  @brief  Whether a 2D test point lies in a registered gap with the associated hit type
+         *
+         *  @param  testPoint2D the test point
+         *  @param  hitType the hit type
+         *  @param  gapTolerance the gap tolerance
+         *
+         *  @return boolean
+         */
+        bool IsInGap(const pandora::CartesianVector &testPoint2D, const pandora::HitType hitType, const float gapTolerance) const;
+
+        /**
+         *  @brief  Calculate the total distance within a given 2D region that is composed of detector gaps
+         *
+         *  @param  minZ the start position in Z
+         *  @param  maxZ the end position in Z
+         *  @param  hitType the hit type
+         *
+         *  @return the total gap distance in Z
+         */
+        float CalculateGapDeltaZ(const float minZ, const float maxZ, const pandora::HitType hitType) const;
+
+    private:
+        /**
+         *  @brief  GapInterval class, the extent in z of a detector gap
+         */
+        class GapInterval
+        {
+        public:
+            /**
+             *  @brief  Constructor
+             *
+             *  @param  pDetectorGap the address of the detector gap
+             *  @param  gapIndex the position of the gap in the detector gap list
+             *  @param  minZ the minimum z extent of the gap
+             *  @param  maxZ the maximum z extent of the gap
+             */
+            GapInterval(const pandora::DetectorGap *const pDetectorGap, const unsigned int gapIndex, const float minZ, const float maxZ);
+
+            const pandora::DetectorGap     *m_pDetectorGap;     ///< The address of the detector gap
+            unsigned int                    m_gapIndex;         ///< The position of the gap in the detector gap list
+            float                           m_minZ;             ///< The minimum z extent of the gap
+            float                           m_maxZ;             ///< The maximum z extent of the gap
+            float                           m_runningMaxZ;      ///< The largest maximum z extent of this and all preceding intervals
+        };
+
+        typedef std::vector<GapInterval> GapIntervalVector;
+        typedef std::vector<const GapInterval*> GapIntervalList;
+
+        /**
+         *  @brief  Sort intervals by their minimum z extent and fill the running maximum z extent
+         *
+         *  @param  gapIntervals the intervals
+         */
+        static void SortIntervals(GapIntervalVector &gapIntervals);
+
+        /**
+         *  @brief  Collect the intervals that overlap a range in z
+         *
+         *  @param  gapIntervals the sorted intervals
+         *  @param  minZ the start of the range in z
+         *  @param  maxZ the end of the range in z
+         *  @param  overlappingIntervals to receive the overlapping intervals
+         */
+        static void GetOverlappingIntervals(const GapIntervalVector &gapIntervals, const float minZ, const float maxZ,
+            GapIntervalList &overlappingIntervals);
+
+        /**
+         *  @brief  Get the line gap intervals relevant to a given hit type
+         *
+         *  @param  hitType the hit type
+         *
+         *  @return the line gap intervals
+         */
+        const GapIntervalVector &GetLineGapIntervals(const pandora::HitType hitType) const;
+
+        GapIntervalVector               m_lineGapsU;        ///< The u view wire gaps
+        GapIntervalVector               m_lineGapsV;        ///< The v view wire gaps
+        GapIntervalVector               m_lineGapsW;        ///< The w view wire gaps
+        GapIntervalVector               m_lineGapsAll;      ///< All u, v and w view wire gaps, for other hit types
+        GapIntervalVector               m_boxGaps;          ///< The box gaps, described by their bounding box extent in z
+        pandora::DetectorGapList        m_otherGaps;        ///< Any other gaps, always checked directly
+        bool                            m_onlyLineGaps;     ///< Whether all registered gaps are line gaps
+    };
+
     /**
      *  @brief  Merge two views (U,V) to give a third view (Z).
      *
@@ -234,6 +335,19 @@ public:
     static bool IsXSamplingPointInGap(const pandora::Pandora &pandora, const float xSample, const TwoDSlidingFitResult &slidingFitResult,
         const float gapTolerance = 0.f);
 
+    /**
+     *  @brief  Whether there is a gap in a cluster (described via its sliding fit result) at a specified x sampling position
+     *
+     *  @param  detectorGapIndex the index of the detector gaps
+     *  @param  xSample the x sampling position
+     *  @param  slidingFitResult the sliding fit result for a cluster
+     *  @param  gapTolerance the gap tolerance
+     *
+     *  @return boolean
+     */
+    static bool IsXSamplingPointInGap(const DetectorGapIndex &detectorGapIndex, const float xSample, const TwoDSlidingFitResult &slidingFitResult,
+        const float gapTolerance = 0.f);
+
     /**
      *  @brief  Calculate the total distance within a given 2D region that is composed of detector gaps
      *
@@ -243,6 +357,18 @@ public:
      *  @param  hitType the hit type
      */
     static float CalculateGapDeltaZ(const pandora::Pandora &pandora, const float minZ, const float maxZ, const pandora::HitType hitType);
+
+private:
+    /**
+     *  @brief  Get the position of a cluster (described via its sliding fit result) at a specified x sampling position, extrapolating
+     *          from the nearer end of the fit if the position lies outside the fit or in a region without fit layers
+     *
+     *  @param  xSample the x sampling position
+     *  @param  slidingFitResult the sliding fit result for a cluster
+     *
+     *  @return the sampling point
+     */
+    static pandora::CartesianVector GetXSamplingPoint(const float xSample, const TwoDSlidingFitResult &slidingFitResult);
 };
 
 } // namespace lar_content
@@ -34,9 +34,9 @@ bool LArMCParticleHelper::IsNeutrinoFinalState(const MCParticle *const pMCPartic
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool LArMCParticleHelper::IsNeutrinoInduced(const MCParticle *const pMCParticle)
+bool LArMCParticleHelper::IsNeutrinoInduced(const MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap)
 {
-    return (LArMCParticleHelper::GetParentNeutrinoId(pMCParticle) != 0);
+    return (LArMCParticleHelper::GetParentNeutrinoId(pMCParticle, pMCAncestryMap) != 0);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -86,8 +86,21 @@ void LArMCParticleHelper::GetTrueNeutrinos(const MCParticleList *const pMCPartic
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const MCParticle *LArMCParticleHelper::GetParentMCParticle(const MCParticle *const pMCParticle)
+const MCParticle *LArMCParticleHelper::GetParentMCParticle(const MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap)
 {
+    if (pMCAncestryMap)
+    {
+        MCAncestryMap::const_iterator ancestryIter(pMCAncestryMap->find(pMCParticle));
+
+        if (pMCAncestryMap->end() != ancestryIter)
+        {
+            if (!ancestryIter->second.m_isSingleParentChain)
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            return ancestryIter->second.m_pParentMCParticle;
+        }
+    }
+
     const MCParticle *pParentMCParticle = pMCParticle;
 
     while (pParentMCParticle->GetParentList().empty() == false)
@@ -103,8 +116,24 @@ const MCParticle *LArMCParticleHelper::GetParentMCParticle(const MCParticle *con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const MCParticle *LArMCParticleHelper::GetPrimaryMCParticle(const MCParticle *const pMCParticle)
+const MCParticle *LArMCParticleHelper::GetPrimaryMCParticle(const MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap)
 {
+    if (pMCAncestryMap)
+    {
+        MCAncestryMap::const_iterator ancestryIter(pMCAncestryMap->find(pMCParticle));
+
+        if (pMCAncestryMap->end() != ancestryIter)
+        {
+            if (!ancestryIter->second.m_isSingleParentChain)
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            if (!ancestryIter->second.m_pPrimaryMCParticle)
+                throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+            return ancestryIter->second.m_pPrimaryMCParticle;
+        }
+    }
+
     // Navigate upward through MC daughter/parent links - collect this particle and all its parents
     MCParticleVector mcVector;
 
@@ -134,9 +163,9 @@ const MCParticle *LArMCParticleHelper::GetPrimaryMCParticle(const MCParticle *co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const MCParticle *LArMCParticleHelper::GetParentNeutrino(const MCParticle *const pMCParticle)
+const MCParticle *LArMCParticleHelper::GetParentNeutrino(const MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap)
 {
-    const MCParticle *const pParentMCParticle = LArMCParticleHelper::GetParentMCParticle(pMCParticle);
+    const MCParticle *const pParentMCParticle = LArMCParticleHelper::GetParentMCParticle(pMCParticle, pMCAncestryMap);
 
     if (!LArMCParticleHelper::IsNeutrino(pParentMCParticle))
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
@@ -146,11 +175,11 @@ const MCParticle *LArMCParticleHelper::GetParentNeutrino(const MCParticle *const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-int LArMCParticleHelper::GetParentNeutrinoId(const MCParticle *const pMCParticle)
+int LArMCParticleHelper::GetParentNeutrinoId(const MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap)
 {
     try
     {
-        const MCParticle *const pParentMCParticle = LArMCParticleHelper::GetParentNeutrino(pMCParticle);
+        const MCParticle *const pParentMCParticle = LArMCParticleHelper::GetParentNeutrino(pMCParticle, pMCAncestryMap);
         return pParentMCParticle->GetParticleId();
     }
     catch (const StatusCodeException &)
@@ -161,25 +190,25 @@ int LArMCParticleHelper::GetParentNeutrinoId(const MCParticle *const pMCParticle
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool LArMCParticleHelper::IsNeutrinoInduced(const Cluster *const pCluster, const float minFraction)
+bool LArMCParticleHelper::IsNeutrinoInduced(const Cluster *const pCluster, const float minFraction, const MCAncestryMap *const pMCAncestryMap)
 {
-    return (LArMCParticleHelper::GetNeutrinoFraction(pCluster) > minFraction);
+    return (LArMCParticleHelper::GetNeutrinoFraction(pCluster, pMCAncestryMap) > minFraction);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool LArMCParticleHelper::IsNeutrinoInduced(const CaloHit *const pCaloHit, const float minFraction)
+bool LArMCParticleHelper::IsNeutrinoInduced(const CaloHit *const pCaloHit, const float minFraction, const MCAncestryMap *const pMCAncestryMap)
 {
-    return (LArMCParticleHelper::GetNeutrinoFraction(pCaloHit) > minFraction);
+    return (LArMCParticleHelper::GetNeutrinoFraction(pCaloHit, pMCAncestryMap) > minFraction);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-float LArMCParticleHelper::GetNeutrinoFraction(const T *const pT)
+float LArMCParticleHelper::GetNeutrinoFraction(const T *const pT, const MCAncestryMap *const pMCAncestryMap)
 {
     float neutrinoWeight(0.f), totalWeight(0.f);
-    LArMCParticleHelper::GetNeutrinoWeight(pT, neutrinoWeight, totalWeight);
+    LArMCParticleHelper::GetNeutrinoWeight(pT, neutrinoWeight, totalWeight, pMCAncestryMap);
 
     if (totalWeight > std::numeric_limits<float>::epsilon())
         return (neutrinoWeight / totalWeight);
@@ -190,7 +219,7 @@ float LArMCParticleHelper::GetNeutrinoFraction(const T *const pT)
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <>
-void LArMCParticleHelper::GetNeutrinoWeight(const CaloHit *const pCaloHit, float &neutrinoWeight, float &totalWeight)
+void LArMCParticleHelper::GetNeutrinoWeight(const CaloHit *const pCaloHit, float &neutrinoWeight, float &totalWeight, const MCAncestryMap *const pMCAncestryMap)
 {
     neutrinoWeight = 0.f; totalWeight = 0.f;
     const MCParticleWeightMap &hitMCParticleWeightMap(pCaloHit->GetMCParticleWeightMap());
@@ -206,7 +235,7 @@ void LArMCParticleHelper::GetNeutrinoWeight(const CaloHit *const pCaloHit, float
     {
         const float weight(hitMCParticleWeightMap.at(pMCParticle));
 
-        if (LArMCParticleHelper::IsNeutrinoInduced(pMCParticle))
+        if (LArMCParticleHelper::IsNeutrinoInduced(pMCParticle, pMCAncestryMap))
             neutrinoWeight += weight;
 
         totalWeight += weight;
@@ -226,7 +255,7 @@ void LArMCParticleHelper::GetNeutrinoWeight(const CaloHit *const pCaloHit, float
 }
 
 template <>
-void LArMCParticleHelper::GetNeutrinoWeight(const Cluster *const pCluster, float &neutrinoWeight, float &totalWeight)
+void LArMCParticleHelper::GetNeutrinoWeight(const Cluster *const pCluster, float &neutrinoWeight, float &totalWeight, const MCAncestryMap *const pMCAncestryMap)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
 
@@ -235,26 +264,26 @@ void LArMCParticleHelper::GetNeutrinoWeight(const Cluster *const pCluster, float
 
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
-    LArMCParticleHelper::GetNeutrinoWeight(&caloHitList, neutrinoWeight, totalWeight);
+    LArMCParticleHelper::GetNeutrinoWeight(&caloHitList, neutrinoWeight, totalWeight, pMCAncestryMap);
 }
 
 template <>
-void LArMCParticleHelper::GetNeutrinoWeight(const ParticleFlowObject *const pPfo, float &neutrinoWeight, float &totalWeight)
+void LArMCParticleHelper::GetNeutrinoWeight(const ParticleFlowObject *const pPfo, float &neutrinoWeight, float &totalWeight, const MCAncestryMap *const pMCAncestryMap)
 {
     ClusterList twoDClusters;
     LArPfoHelper::GetTwoDClusterList(pPfo, twoDClusters);
-    LArMCParticleHelper::GetNeutrinoWeight(&twoDClusters, neutrinoWeight, totalWeight);
+    LArMCParticleHelper::GetNeutrinoWeight(&twoDClusters, neutrinoWeight, totalWeight, pMCAncestryMap);
 }
 
 template <typename T>
-void LArMCParticleHelper::GetNeutrinoWeight(const T *const pT, float &neutrinoWeight, float &totalWeight)
+void LArMCParticleHelper::GetNeutrinoWeight(const T *const pT, float &neutrinoWeight, float &totalWeight, const MCAncestryMap *const pMCAncestryMap)
 {
     neutrinoWeight = 0.f; totalWeight = 0.f;
 
     for (const auto *const pValueT : *pT)
     {
         float thisNeutrinoWeight = 0.f, thisTotalWeight = 0.f;
-        LArMCParticleHelper::GetNeutrinoWeight(pValueT, thisNeutrinoWeight, thisTotalWeight);
+        LArMCParticleHelper::GetNeutrinoWeight(pValueT, thisNeutrinoWeight, thisTotalWeight, pMCAncestryMap);
         neutrinoWeight += thisNeutrinoWeight;
         totalWeight += thisTotalWeight;
     }
@@ -262,6 +291,56 @@ void LArMCParticleHelper::GetNeutrinoWeight(const T *const pT, float &neutrinoWe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArMCParticleHelper::GetMCAncestryMap(const MCParticleList *const pMCParticleList, MCAncestryMap &mcAncestryMap)
+{
+    MCParticleVector mcChain;
+
+    for (const MCParticle *const pMCParticle : *pMCParticleList)
+    {
+        // Navigate upward until reaching a particle of known ancestry, or a particle without a unique parent
+        mcChain.clear();
+        const MCParticle *pThisMCParticle(pMCParticle);
+
+        while (!mcAncestryMap.count(pThisMCParticle))
+        {
+            mcChain.push_back(pThisMCParticle);
+
+            if (1 != pThisMCParticle->GetParentList().size())
+                break;
+
+            pThisMCParticle = *(pThisMCParticle->GetParentList().begin());
+        }
+
+        // Navigate back downward, deriving the ancestry of each particle from that of its parent
+        for (MCParticleVector::const_reverse_iterator iter = mcChain.rbegin(), iterEnd = mcChain.rend(); iter != iterEnd; ++iter)
+        {
+            const MCParticle *const pChainMCParticle(*iter);
+            const MCParticleList &parentList(pChainMCParticle->GetParentList());
+            MCAncestry mcAncestry;
+
+            if (parentList.empty())
+            {
+                mcAncestry.m_isSingleParentChain = true;
+                mcAncestry.m_pParentMCParticle = pChainMCParticle;
+                mcAncestry.m_pPrimaryMCParticle = LArMCParticleHelper::IsVisible(pChainMCParticle) ? pChainMCParticle : nullptr;
+            }
+            else if (1 == parentList.size())
+            {
+                const MCAncestry &parentAncestry(mcAncestryMap.at(*(parentList.begin())));
+                mcAncestry.m_isSingleParentChain = parentAncestry.m_isSingleParentChain;
+                mcAncestry.m_pParentMCParticle = parentAncestry.m_pParentMCParticle;
+                mcAncestry.m_pPrimaryMCParticle = parentAncestry.m_pPrimaryMCParticle ? parentAncestry.m_pPrimaryMCParticle :
+                    (LArMCParticleHelper::IsVisible(pChainMCParticle) ? pChainMCParticle : nullptr);
+                mcAncestry.m_depth = parentAncestry.m_depth + 1;
+            }
+
+            (void) mcAncestryMap.insert(MCAncestryMap::value_type(pChainMCParticle, mcAncestry));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool LArMCParticleHelper::IsPrimary(const pandora::MCParticle *const pMCParticle)
 {
     try
@@ -279,11 +358,14 @@ bool LArMCParticleHelper::IsPrimary(const pandora::MCParticle *const pMCParticle
 
 void LArMCParticleHelper::GetMCPrimaryMap(const MCParticleList *const pMCParticleList, MCRelationMap &mcPrimaryMap)
 {
+    MCAncestryMap mcAncestryMap;
+    LArMCParticleHelper::GetMCAncestryMap(pMCParticleList, mcAncestryMap);
+
     for (const MCParticle *const pMCParticle : *pMCParticleList)
     {
         try
         {
-            const MCParticle *const pPrimaryMCParticle = LArMCParticleHelper::GetPrimaryMCParticle(pMCParticle);
+            const MCParticle *const pPrimaryMCParticle = LArMCParticleHelper::GetPrimaryMCParticle(pMCParticle, &mcAncestryMap);
             mcPrimaryMap[pMCParticle] = pPrimaryMCParticle;
         }
         catch (const StatusCodeException &)
@@ -296,9 +378,14 @@ void LArMCParticleHelper::GetMCPrimaryMap(const MCParticleList *const pMCParticl
 
 void LArMCParticleHelper::GetPrimaryMCParticleList(const MCParticleList *const pMCParticleList, MCParticleVector &mcPrimaryVector)
 {
+    MCAncestryMap mcAncestryMap;
+    LArMCParticleHelper::GetMCAncestryMap(pMCParticleList, mcAncestryMap);
+
     for (const MCParticle *const pMCParticle : *pMCParticleList)
     {
-        if (LArMCParticleHelper::IsPrimary(pMCParticle))
+        const MCAncestry &mcAncestry(mcAncestryMap.at(pMCParticle));
+
+        if (mcAncestry.m_isSingleParentChain && (pMCParticle == mcAncestry.m_pPrimaryMCParticle))
             mcPrimaryVector.push_back(pMCParticle);
     }
 
@@ -840,15 +927,26 @@ bool LArMCParticleHelper::PassMCParticleChecks(const MCParticle *const pOriginal
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template float LArMCParticleHelper::GetNeutrinoFraction(const CaloHit *const);
-template float LArMCParticleHelper::GetNeutrinoFraction(const Cluster *const);
-template float LArMCParticleHelper::GetNeutrinoFraction(const ParticleFlowObject *const);
-template float LArMCParticleHelper::GetNeutrinoFraction(const CaloHitList *const);
-template float LArMCParticleHelper::GetNeutrinoFraction(const ClusterList *const);
-template float LArMCParticleHelper::GetNeutrinoFraction(const PfoList *const);
+LArMCParticleHelper::MCAncestry::MCAncestry() :
+    m_isSingleParentChain(false),
+    m_pParentMCParticle(nullptr),
+    m_pPrimaryMCParticle(nullptr),
+    m_depth(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template float LArMCParticleHelper::GetNeutrinoFraction(const CaloHit *const, const MCAncestryMap *const);
+template float LArMCParticleHelper::GetNeutrinoFraction(const Cluster *const, const MCAncestryMap *const);
+template float LArMCParticleHelper::GetNeutrinoFraction(const ParticleFlowObject *const, const MCAncestryMap *const);
+template float LArMCParticleHelper::GetNeutrinoFraction(const CaloHitList *const, const MCAncestryMap *const);
+template float LArMCParticleHelper::GetNeutrinoFraction(const ClusterList *const, const MCAncestryMap *const);
+template float LArMCParticleHelper::GetNeutrinoFraction(const PfoList *const, const MCAncestryMap *const);
 
-template void LArMCParticleHelper::GetNeutrinoWeight(const CaloHitList *const, float &, float &);
-template void LArMCParticleHelper::GetNeutrinoWeight(const ClusterList *const, float &, float &);
-template void LArMCParticleHelper::GetNeutrinoWeight(const PfoList *const, float &, float &);
+template void LArMCParticleHelper::GetNeutrinoWeight(const CaloHitList *const, float &, float &, const MCAncestryMap *const);
+template void LArMCParticleHelper::GetNeutrinoWeight(const ClusterList *const, float &, float &, const MCAncestryMap *const);
+template void LArMCParticleHelper::GetNeutrinoWeight(const PfoList *const, float &, float &, const MCAncestryMap *const);
 
 } // namespace lar_content
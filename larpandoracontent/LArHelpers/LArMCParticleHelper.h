@@ -29,6 +29,34 @@ public:
      */
     enum InteractionType : int;
 
+    /**
+     *  @brief  MCAncestry class, the memoised relationships between a mc particle and its ancestors
+     */
+    class MCAncestry
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        MCAncestry();
+
+        bool                        m_isSingleParentChain;  ///< Whether each particle in the ancestry has at most one parent
+        const pandora::MCParticle  *m_pParentMCParticle;    ///< The address of the top-level parent mc particle
+        const pandora::MCParticle  *m_pPrimaryMCParticle;   ///< The address of the primary mc particle, nullptr if none
+        unsigned int                m_depth;                ///< The number of parent links between the mc particle and its top-level parent
+    };
+
+    typedef std::unordered_map<const pandora::MCParticle*, MCAncestry> MCAncestryMap;
+
+    /**
+     *  @brief  Get the ancestry of each mc particle in a provided list (and of their ancestors), in a single pass in which each particle
+     *          is visited once, with the ancestry of each particle derived from that of its parent
+     *
+     *  @param  pMCParticleList the input mc particle list
+     *  @param  mcAncestryMap to receive the mapping between mc particles and their ancestry
+     */
+    static void GetMCAncestryMap(const pandora::MCParticleList *const pMCParticleList, MCAncestryMap &mcAncestryMap);
+
     /**
      *  @brief  Whether a mc particle is a final-state particle from a neutrino or antineutrino interaction
      *
@@ -42,10 +70,11 @@ public:
      *  @brief  Whether a mc particle is produced by the interation of a neutrino or antineutrino
      *
      *  @param  pMCParticle the input mc particle
+     *  @param  pMCAncestryMap address of an optional mc ancestry map, used in place of navigating the parent links where possible
      *
      *  @return boolean
      */
-    static bool IsNeutrinoInduced(const pandora::MCParticle *const pMCParticle);
+    static bool IsNeutrinoInduced(const pandora::MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap = nullptr);
 
     /**
      *  @brief  Whether a mc particle is a neutrino or antineutrino
@@ -77,67 +106,74 @@ public:
      *  @brief  Get the primary parent mc particle
      *
      *  @param  pMCParticle the input mc particle
+     *  @param  pMCAncestryMap address of an optional mc ancestry map, used in place of navigating the parent links where possible
      *
      *  @return address of the primary parent mc particle
      */
-    static const pandora::MCParticle *GetPrimaryMCParticle(const pandora::MCParticle *const pMCParticle);
+    static const pandora::MCParticle *GetPrimaryMCParticle(const pandora::MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap = nullptr);
 
     /**
      *  @brief  Get the parent mc particle
      *
      *  @param  pMCParticle the input mc particle
+     *  @param  pMCAncestryMap address of an optional mc ancestry map, used in place of navigating the parent links where possible
      *
      *  @return address of the parent mc particle
      */
-    static const pandora::MCParticle *GetParentMCParticle(const pandora::MCParticle *const pMCParticle);
+    static const pandora::MCParticle *GetParentMCParticle(const pandora::MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap = nullptr);
 
      /**
      *  @brief  Get parent neutrino or antineutrino
      *
      *  @param  pMCParticle the input mc particle
+     *  @param  pMCAncestryMap address of an optional mc ancestry map, used in place of navigating the parent links where possible
      *
      *  @return address of primary neutrino mc particle
      */
-    static const pandora::MCParticle *GetParentNeutrino(const pandora::MCParticle *const pMCParticle);
+    static const pandora::MCParticle *GetParentNeutrino(const pandora::MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap = nullptr);
 
     /**
      *  @brief  Get parent neutrino or antineutrino pdg code
      *
      *  @param  pMCParticle the input mc particle
+     *  @param  pMCAncestryMap address of an optional mc ancestry map, used in place of navigating the parent links where possible
      *
      *  @return pdg code of neutrino (or zero, otherwise)
      */
-    static int GetParentNeutrinoId(const pandora::MCParticle *const pMCParticle);
+    static int GetParentNeutrinoId(const pandora::MCParticle *const pMCParticle, const MCAncestryMap *const pMCAncestryMap = nullptr);
 
     /**
      *  @brief  Whether a cluster is the product of a neutrino interaction
      *
      *  @param  pCluster the input cluster
      *  @param  minFraction minimum threshold for the combined fraction of neutrino-induced particles associated with the cluster
+     *  @param  pMCAncestryMap address of an optional mc ancestry map, used in place of navigating the parent links where possible
      *
      *  @return boolean
      */
-    static bool IsNeutrinoInduced(const pandora::Cluster *const pCluster, const float minFraction = 0.f);
+    static bool IsNeutrinoInduced(const pandora::Cluster *const pCluster, const float minFraction = 0.f, const MCAncestryMap *const pMCAncestryMap = nullptr);
 
     /**
      *  @brief  Whether a hit is the product of a neutrino interaction
      *
      *  @param  pCaloHit the input calo hit
      *  @param  minFraction minimum threshold for the combined fraction of neutrino-induced particles associated with the hit
+     *  @param  pMCAncestryMap address of an optional mc ancestry map, used in place of navigating the parent links where possible
      *
      *  @return boolean
      */
-    static bool IsNeutrinoInduced(const pandora::CaloHit *const pCaloHit, const float minFraction = 0.f);
+    static bool IsNeutrinoInduced(const pandora::CaloHit *const pCaloHit, const float minFraction = 0.f, const MCAncestryMap *const pMCAncestryMap = nullptr);
 
     /**
      *  @brief  Calculate the fractional weight of neutrino-induced particles associated with a given object
      *
      *  @param  pT the input object
+     *  @param  pMCAncestryMap address of an optional mc ancestry map, used in place of navigating the parent links where possible
      *
      *  @return the fractional weight of neutrino-induced particles associated with the object
      */
     template <typename T>
-    static float GetNeutrinoFraction(const T *const pT);
+    static float GetNeutrinoFraction(const T *const pT, const MCAncestryMap *const pMCAncestryMap = nullptr);
 
     /**
      *  @brief  Calculate the weight of neutrino-induced particles (and, separately, of all particles) associated with a given object
@@ -145,9 +181,10 @@ public:
      *  @param  pT the input object
      *  @param  neutrinoWeight to receive the neutrino weight
      *  @param  totalWeight to receive the total weight
+     *  @param  pMCAncestryMap address of an optional mc ancestry map, used in place of navigating the parent links where possible
      */
     template <typename T>
-    static void GetNeutrinoWeight(const T *const pT, float &neutrinoWeight, float &totalWeight);
+    static void GetNeutrinoWeight(const T *const pT, float &neutrinoWeight, float &totalWeight, const MCAncestryMap *const pMCAncestryMap = nullptr);
 
     typedef std::unordered_map<const pandora::MCParticle*, const pandora::MCParticle*> MCRelationMap;
 
@@ -266,6 +266,72 @@ void LArMonitoringHelper::GetMCParticleToPfoMatches(const CaloHitList *const pCa
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMonitoringHelper::GetMCParticleToPfoHitCounts(const CaloHitList *const pCaloHitList, const PfoList &pfoList, const bool collapseToPrimaryPfos,
+    const CaloHitToMCMap &hitToPrimaryMCMap, PfoHitCountMap &pfoHitCountMap, MCToPfoHitCountMatrix &mcToPfoHitCountMatrix)
+{
+    std::unordered_map<const CaloHit*, unsigned int> caloHitIdMap;
+    MCParticleVector primaryMCParticleVector;
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        if (!caloHitIdMap.insert(std::unordered_map<const CaloHit*, unsigned int>::value_type(pCaloHit, primaryMCParticleVector.size())).second)
+            continue;
+
+        CaloHitToMCMap::const_iterator mcIter = hitToPrimaryMCMap.find(pCaloHit);
+        primaryMCParticleVector.push_back((hitToPrimaryMCMap.end() != mcIter) ? mcIter->second : nullptr);
+    }
+
+    for (const ParticleFlowObject *const pPfo : pfoList)
+    {
+        ClusterList clusterList;
+
+        if (!collapseToPrimaryPfos)
+        {
+            LArPfoHelper::GetTwoDClusterList(pPfo, clusterList);
+        }
+        else
+        {
+            if (!LArPfoHelper::IsFinalState(pPfo))
+                continue;
+
+            PfoList downstreamPfoList;
+            LArPfoHelper::GetAllDownstreamPfos(pPfo, downstreamPfoList);
+
+            for (const ParticleFlowObject *const pDownstreamPfo : downstreamPfoList)
+                LArPfoHelper::GetTwoDClusterList(pDownstreamPfo, clusterList);
+        }
+
+        HitCounts &pfoHitCounts(pfoHitCountMap[pPfo]);
+
+        for (const Cluster *const pCluster : clusterList)
+        {
+            CaloHitList clusterHits;
+            pCluster->GetOrderedCaloHitList().FillCaloHitList(clusterHits);
+            clusterHits.insert(clusterHits.end(), pCluster->GetIsolatedCaloHitList().begin(), pCluster->GetIsolatedCaloHitList().end());
+
+            for (const CaloHit *const pCaloHit : clusterHits)
+            {
+                if (TPC_3D == pCaloHit->GetHitType())
+                    throw StatusCodeException(STATUS_CODE_FAILURE);
+
+                std::unordered_map<const CaloHit*, unsigned int>::const_iterator idIter = caloHitIdMap.find(pCaloHit);
+
+                if (caloHitIdMap.end() == idIter)
+                    continue;
+
+                pfoHitCounts.AddHit(pCaloHit->GetHitType());
+
+                const MCParticle *const pPrimaryParticle(primaryMCParticleVector.at(idIter->second));
+
+                if (pPrimaryParticle)
+                    mcToPfoHitCountMatrix[pPrimaryParticle][pPfo].AddHit(pCaloHit->GetHitType());
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
 void LArMonitoringHelper::CollectCaloHits(const ParticleFlowObject *const pParentPfo, CaloHitList &caloHitList)
@@ -308,4 +374,35 @@ unsigned int LArMonitoringHelper::CountHitsByType(const HitType hitType, const C
     return nHitsOfSpecifiedType;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMonitoringHelper::HitCounts::HitCounts() :
+    m_nHitsTotal(0),
+    m_nHitsU(0),
+    m_nHitsV(0),
+    m_nHitsW(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMonitoringHelper::HitCounts::AddHit(const HitType hitType)
+{
+    ++m_nHitsTotal;
+
+    if (TPC_VIEW_U == hitType)
+    {
+        ++m_nHitsU;
+    }
+    else if (TPC_VIEW_V == hitType)
+    {
+        ++m_nHitsV;
+    }
+    else if (TPC_VIEW_W == hitType)
+    {
+        ++m_nHitsW;
+    }
+}
+
 } // namespace lar_content
@@ -33,6 +33,33 @@ public:
 
     typedef std::unordered_map<const pandora::MCParticle*, PfoContributionMap> MCToPfoMatchingMap;
 
+    /**
+     *  @brief  HitCounts class, recording the total number of hits and the number of hits in each view
+     */
+    class HitCounts
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        HitCounts();
+
+        /**
+         *  @brief  Count an additional hit of the specified type
+         *
+         *  @param  hitType the hit type
+         */
+        void AddHit(const pandora::HitType hitType);
+
+        unsigned int            m_nHitsTotal;               ///< The total number of hits
+        unsigned int            m_nHitsU;                   ///< The number of u hits
+        unsigned int            m_nHitsV;                   ///< The number of v hits
+        unsigned int            m_nHitsW;                   ///< The number of w hits
+    };
+
+    typedef std::unordered_map<const pandora::ParticleFlowObject*, HitCounts> PfoHitCountMap;
+    typedef std::unordered_map<const pandora::MCParticle*, PfoHitCountMap> MCToPfoHitCountMatrix;
+
     /**
      *  @brief  Extract a list of target pfos consisting of either i) primary/final-state pfos only, or ii) a full list of all
      *          non-neutrino pfos and their daughters
@@ -91,6 +118,22 @@ public:
         const CaloHitToMCMap &hitToPrimaryMCMap, MCToPfoMap &mcToBestPfoMap, MCContributionMap &mcToBestPfoHitsMap,
         MCToPfoMatchingMap &mcToFullPfoMatchingMap);
 
+    /**
+     *  @brief  Count the hits in each Pfo and the hits shared between each primary MC particle and Pfo. Each calo hit is assigned a dense
+     *          integer id once, after which the Pfo hits are visited in a single pass, with no intermediate hit lists. The counts are
+     *          identical to the sizes (and per-view hit counts) of the lists provided by GetPfoToCaloHitMatches and GetMCParticleToPfoMatches.
+     *
+     *  @param  pCaloHitList the input list of calo hits
+     *  @param  pfoList the input list of Pfos
+     *  @param  collapseToPrimaryPfos whether to collapse hits associated with daughter pfos back to the primary pfo
+     *  @param  hitToPrimaryMCMap input mapping between calo hits and primary mc particles
+     *  @param  pfoHitCountMap output mapping between Pfos and their numbers of hits
+     *  @param  mcToPfoHitCountMatrix output sparse matrix of numbers of hits shared between MC particles and Pfos
+     */
+    static void GetMCParticleToPfoHitCounts(const pandora::CaloHitList *const pCaloHitList, const pandora::PfoList &pfoList,
+        const bool collapseToPrimaryPfos, const CaloHitToMCMap &hitToPrimaryMCMap, PfoHitCountMap &pfoHitCountMap,
+        MCToPfoHitCountMatrix &mcToPfoHitCountMatrix);
+
     /**
      *  @brief  Collect up all calo hits associated with a Pfo and its daughters
      *
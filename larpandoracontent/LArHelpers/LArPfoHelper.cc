@@ -426,17 +426,27 @@ const Vertex *LArPfoHelper::GetVertex(const ParticleFlowObject *const pPfo)
 void LArPfoHelper::GetSlidingFitTrajectory(const CartesianPointVector &pointVector, const CartesianVector &vertexPosition,
     const unsigned int layerWindow, const float layerPitch, LArTrackStateVector &trackStateVector)
 {
-    LArPfoHelper::SlidingFitTrajectoryImpl(&pointVector, vertexPosition, layerWindow, layerPitch, trackStateVector);
+    SlidingFitTrajectoryBuffers buffers;
+    LArPfoHelper::SlidingFitTrajectoryImpl(&pointVector, vertexPosition, layerWindow, layerPitch, buffers, trackStateVector);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArPfoHelper::GetSlidingFitTrajectory(const ParticleFlowObject *const pPfo, const Vertex *const pVertex,
     const unsigned int layerWindow, const float layerPitch, LArTrackStateVector &trackStateVector)
+{
+    SlidingFitTrajectoryBuffers buffers;
+    LArPfoHelper::GetSlidingFitTrajectory(pPfo, pVertex, layerWindow, layerPitch, buffers, trackStateVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPfoHelper::GetSlidingFitTrajectory(const ParticleFlowObject *const pPfo, const Vertex *const pVertex,
+    const unsigned int layerWindow, const float layerPitch, SlidingFitTrajectoryBuffers &buffers, LArTrackStateVector &trackStateVector)
 {
     CaloHitList caloHitList;
     LArPfoHelper::GetCaloHits(pPfo, TPC_3D, caloHitList);
-    LArPfoHelper::SlidingFitTrajectoryImpl(&caloHitList, pVertex->GetPosition(), layerWindow, layerPitch, trackStateVector);
+    LArPfoHelper::SlidingFitTrajectoryImpl(&caloHitList, pVertex->GetPosition(), layerWindow, layerPitch, buffers, trackStateVector);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -534,9 +544,11 @@ bool LArPfoHelper::SortByNHits(const ParticleFlowObject *const pLhs, const Parti
 
 template <typename T>
 void LArPfoHelper::SlidingFitTrajectoryImpl(const T *const pT, const CartesianVector &vertexPosition, const unsigned int layerWindow,
-    const float layerPitch, LArTrackStateVector &trackStateVector)
+    const float layerPitch, SlidingFitTrajectoryBuffers &buffers, LArTrackStateVector &trackStateVector)
 {
-    CartesianPointVector pointVector;
+    // ATTN Buffers are cleared rather than reallocated, so their capacity carries over between calls
+    CartesianPointVector &pointVector(buffers.m_pointVector);
+    pointVector.clear();
 
     for (const auto &nextPoint : *pT)
         pointVector.push_back(LArPfoHelper::TypeAdaptor::GetPosition(nextPoint));
@@ -546,7 +558,8 @@ void LArPfoHelper::SlidingFitTrajectoryImpl(const T *const pT, const CartesianVe
 
     std::sort(pointVector.begin(), pointVector.end(), LArClusterHelper::SortCoordinatesByPosition);
 
-    LArTrackTrajectory trackTrajectory;
+    LArTrackTrajectory &trackTrajectory(buffers.m_trackTrajectory);
+    trackTrajectory.clear();
 
     try
     {
@@ -637,7 +650,7 @@ const CaloHit *LArPfoHelper::TypeAdaptor::GetCaloHit(const CaloHit *const &pCalo
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template void LArPfoHelper::SlidingFitTrajectoryImpl(const CartesianPointVector *const, const CartesianVector &, const unsigned int, const float, LArTrackStateVector &);
-template void LArPfoHelper::SlidingFitTrajectoryImpl(const CaloHitList *const, const CartesianVector &, const unsigned int, const float, LArTrackStateVector &);
+template void LArPfoHelper::SlidingFitTrajectoryImpl(const CartesianPointVector *const, const CartesianVector &, const unsigned int, const float, SlidingFitTrajectoryBuffers &, LArTrackStateVector &);
+template void LArPfoHelper::SlidingFitTrajectoryImpl(const CaloHitList *const, const CartesianVector &, const unsigned int, const float, SlidingFitTrajectoryBuffers &, LArTrackStateVector &);
 
 } // namespace lar_content
@@ -23,6 +23,16 @@ namespace lar_content
 class LArPfoHelper
 {
 public:
+    /**
+     *  @brief  SlidingFitTrajectoryBuffers class, scratch storage for the sliding fit trajectory, reusable across calls by a single thread
+     */
+    class SlidingFitTrajectoryBuffers
+    {
+    public:
+        pandora::CartesianPointVector   m_pointVector;          ///< The sorted input positions
+        LArTrackTrajectory              m_trackTrajectory;      ///< The trajectory points and their projections along the track
+    };
+
     /**
      *  @brief  Get a list of coordinates of a particular hit type from an input pfos
      *
@@ -291,6 +301,19 @@ public:
     static void GetSlidingFitTrajectory(const pandora::ParticleFlowObject *const pPfo, const pandora::Vertex *const pVertex,
         const unsigned int slidingFitHalfWindow, const float layerPitch, LArTrackStateVector &trackStateVector);
 
+    /**
+     *  @brief  Apply 3D sliding fit to Pfo and return track trajectory, using the provided scratch buffers
+     *
+     *  @param  pPfo  the address of the input Pfo
+     *  @param  pVertex  the address of the input vertex
+     *  @param  slidingFitHalfWindow  size of half window for sliding linear fit
+     *  @param  layerPitch  size of pitch for sliding linear fit
+     *  @param  buffers  the scratch buffers, contents are overwritten
+     *  @param  trackStateVector  the output track trajectory
+     */
+    static void GetSlidingFitTrajectory(const pandora::ParticleFlowObject *const pPfo, const pandora::Vertex *const pVertex,
+        const unsigned int slidingFitHalfWindow, const float layerPitch, SlidingFitTrajectoryBuffers &buffers, LArTrackStateVector &trackStateVector);
+
     /**
      *  @brief  Perform PCA analysis on a set of 3D points and return results
      *
@@ -331,11 +354,12 @@ private:
      *  @param  pVertex the address of the input vertex
      *  @param  slidingFitHalfWindow  size of half window for sliding linear fit
      *  @param  layerPitch  size of pitch for sliding linear fit
+     *  @param  buffers  the scratch buffers
      *  @param  trackStateVector  the output track trajectory
      */
     template <typename T>
     static void SlidingFitTrajectoryImpl(const T *const pT, const pandora::CartesianVector &vertexPosition, const unsigned int layerWindow,
-        const float layerPitch, LArTrackStateVector &trackStateVector);
+        const float layerPitch, SlidingFitTrajectoryBuffers &buffers, LArTrackStateVector &trackStateVector);
 
     /**
      *  @brief  TypeAdaptor
@@ -0,0 +1,179 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArProfilingHelper.cc
+ *
+ *  @brief  Implementation of the profiling helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+std::atomic<bool> LArProfilingHelper::m_isEnabled(false);
+std::mutex LArProfilingHelper::m_mutex;
+unsigned int LArProfilingHelper::m_nEvents = 0;
+LArProfilingHelper::ProfileMap LArProfilingHelper::m_eventProfileMap;
+LArProfilingHelper::ProfileMap LArProfilingHelper::m_jobProfileMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::SetProfilingEnabled(const bool isEnabled)
+{
+    m_isEnabled = isEnabled;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::Record(const std::string &label, const double wallTime)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    ProfileEntry &profileEntry(m_eventProfileMap[label]);
+    ++profileEntry.m_nCalls;
+    profileEntry.m_wallTime += wallTime;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::EndEvent(const bool printEventProfile)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (printEventProfile)
+        LArProfilingHelper::PrintProfile("Event " + std::to_string(m_nEvents), m_eventProfileMap, 1);
+
+    for (const ProfileMap::value_type &mapEntry : m_eventProfileMap)
+    {
+        ProfileEntry &profileEntry(m_jobProfileMap[mapEntry.first]);
+        profileEntry.m_nCalls += mapEntry.second.m_nCalls;
+        profileEntry.m_wallTime += mapEntry.second.m_wallTime;
+    }
+
+    m_eventProfileMap.clear();
+    ++m_nEvents;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::PrintJobProfile()
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    LArProfilingHelper::PrintProfile("Job", m_jobProfileMap, m_nEvents);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::WriteJobProfile(const std::string &fileName)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    std::ofstream outputFile(fileName.c_str());
+
+    if (!outputFile.is_open())
+    {
+        std::cout << "LArProfilingHelper::WriteJobProfile - unable to open output file " << fileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    outputFile << "Label,NEvents,NCalls,WallTime,WallTimePerCall" << std::endl;
+
+    for (const ProfileMap::value_type &mapEntry : m_jobProfileMap)
+    {
+        const ProfileEntry &profileEntry(mapEntry.second);
+        outputFile << mapEntry.first << "," << m_nEvents << "," << profileEntry.m_nCalls << "," << profileEntry.m_wallTime << ","
+                   << (profileEntry.m_nCalls > 0 ? profileEntry.m_wallTime / profileEntry.m_nCalls : 0.) << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::Reset()
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_nEvents = 0;
+    m_eventProfileMap.clear();
+    m_jobProfileMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArProfilingHelper::PrintProfile(const std::string &title, const ProfileMap &profileMap, const unsigned int nEvents)
+{
+    std::cout << "---LArProfilingHelper: " << title << " profile, " << nEvents << " event(s), inclusive wall times" << std::endl
+              << std::left << std::setw(60) << "Label" << std::right << std::setw(10) << "NCalls" << std::setw(15) << "WallTime[s]"
+              << std::setw(15) << "PerCall[ms]" << std::endl;
+
+    for (const ProfileMap::value_type &mapEntry : profileMap)
+    {
+        const ProfileEntry &profileEntry(mapEntry.second);
+        std::cout << std::left << std::setw(60) << mapEntry.first << std::right << std::setw(10) << profileEntry.m_nCalls
+                  << std::setw(15) << profileEntry.m_wallTime << std::setw(15)
+                  << (profileEntry.m_nCalls > 0 ? 1000. * profileEntry.m_wallTime / profileEntry.m_nCalls : 0.) << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::ScopedTimer::ScopedTimer(const Process *const pProcess) :
+    m_isActive(LArProfilingHelper::IsProfilingEnabled()),
+    m_pProcess(pProcess),
+    m_label(),
+    m_startTime(m_isActive ? std::chrono::steady_clock::now() : TimePoint())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::ScopedTimer::ScopedTimer(const Process *const pParentProcess, const std::string &label) :
+    m_isActive(LArProfilingHelper::IsProfilingEnabled()),
+    m_pProcess(pParentProcess),
+    m_label(m_isActive ? label : std::string()),
+    m_startTime(m_isActive ? std::chrono::steady_clock::now() : TimePoint())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::ScopedTimer::ScopedTimer(const std::string &label) :
+    m_isActive(LArProfilingHelper::IsProfilingEnabled()),
+    m_pProcess(nullptr),
+    m_label(m_isActive ? label : std::string()),
+    m_startTime(m_isActive ? std::chrono::steady_clock::now() : TimePoint())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::ScopedTimer::~ScopedTimer()
+{
+    if (!m_isActive)
+        return;
+
+    const std::chrono::duration<double> wallTime(std::chrono::steady_clock::now() - m_startTime);
+    std::string label(m_label);
+
+    if (m_pProcess)
+        label = m_pProcess->GetType() + "/" + m_pProcess->GetInstanceName() + (m_label.empty() ? "" : "/" + m_label);
+
+    LArProfilingHelper::Record(label, wallTime.count());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArProfilingHelper::ProfileEntry::ProfileEntry() :
+    m_nCalls(0),
+    m_wallTime(0.)
+{
+}
+
+} // namespace lar_content
@@ -0,0 +1,159 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArProfilingHelper.h
+ *
+ *  @brief  Header file for the profiling helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PROFILING_HELPER_H
+#define LAR_PROFILING_HELPER_H 1
+
+#include "Pandora/Process.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArProfilingHelper class
+ */
+class LArProfilingHelper
+{
+public:
+    /**
+     *  @brief  ScopedTimer class, records the wall time between its construction and destruction
+     */
+    class ScopedTimer
+    {
+    public:
+        /**
+         *  @brief  Constructor, labelling the record using the type and instance name of a process
+         *
+         *  @param  pProcess the address of the algorithm or algorithm tool being timed
+         */
+        ScopedTimer(const pandora::Process *const pProcess);
+
+        /**
+         *  @brief  Constructor, labelling the record using the type and instance name of a parent process followed by a label
+         *
+         *  @param  pParentProcess the address of the algorithm running the timed operation
+         *  @param  label the label for the operation, within the parent process
+         */
+        ScopedTimer(const pandora::Process *const pParentProcess, const std::string &label);
+
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  label the label for the record
+         */
+        ScopedTimer(const std::string &label);
+
+        /**
+         *  @brief  Destructor
+         */
+        ~ScopedTimer();
+
+    private:
+        typedef std::chrono::steady_clock::time_point TimePoint;
+
+        const bool                  m_isActive;             ///< Whether profiling was enabled when the timer was constructed
+        const pandora::Process     *m_pProcess;             ///< The address of the process being timed, or of the parent process, if any
+        const std::string           m_label;                ///< The label for the record, appended to any process type and instance name
+        const TimePoint             m_startTime;            ///< The start time
+    };
+
+    /**
+     *  @brief  Set whether profiling is enabled, for all pandora instances
+     *
+     *  @param  isEnabled whether profiling is enabled
+     */
+    static void SetProfilingEnabled(const bool isEnabled);
+
+    /**
+     *  @brief  Whether profiling is enabled
+     *
+     *  @return boolean
+     */
+    static bool IsProfilingEnabled();
+
+    /**
+     *  @brief  Add a record to the profile for the current event
+     *
+     *  @param  label the label for the record
+     *  @param  wallTime the wall time, in seconds
+     */
+    static void Record(const std::string &label, const double wallTime);
+
+    /**
+     *  @brief  Close the profile for the current event, adding it to the profile for the job
+     *
+     *  @param  printEventProfile whether to print the profile for the current event
+     */
+    static void EndEvent(const bool printEventProfile);
+
+    /**
+     *  @brief  Print the profile for the job
+     */
+    static void PrintJobProfile();
+
+    /**
+     *  @brief  Write the profile for the job to a csv file
+     *
+     *  @param  fileName the output file name
+     */
+    static void WriteJobProfile(const std::string &fileName);
+
+    /**
+     *  @brief  Clear the profiles for the current event and for the job
+     */
+    static void Reset();
+
+private:
+    /**
+     *  @brief  ProfileEntry class
+     */
+    class ProfileEntry
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        ProfileEntry();
+
+        unsigned int                m_nCalls;               ///< The number of calls
+        double                      m_wallTime;             ///< The total wall time, in seconds
+    };
+
+    typedef std::map<std::string, ProfileEntry> ProfileMap;
+
+    /**
+     *  @brief  Print a profile, with the profile mutex already held by the caller
+     *
+     *  @param  title the title for the profile
+     *  @param  profileMap the profile map
+     *  @param  nEvents the number of events contributing to the profile
+     */
+    static void PrintProfile(const std::string &title, const ProfileMap &profileMap, const unsigned int nEvents);
+
+    static std::atomic<bool>        m_isEnabled;            ///< Whether profiling is enabled
+    static std::mutex               m_mutex;                ///< The mutex guarding the event count and profiles, which timers may update from any thread
+    static unsigned int             m_nEvents;              ///< The number of events contributing to the job profile
+    static ProfileMap               m_eventProfileMap;      ///< The profile for the current event
+    static ProfileMap               m_jobProfileMap;        ///< The profile for the job
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool LArProfilingHelper::IsProfilingEnabled()
+{
+    return m_isEnabled.load();
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PROFILING_HELPER_H
@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -32,23 +33,14 @@ const LArTPC &LArStitchingHelper::FindClosestTPC(const Pandora &pandora, const L
 
     const LArTPC *pClosestTPC(nullptr);
     float closestSeparation(std::numeric_limits<float>::max());
-    const float maxDisplacement(30.f); // TODO: 30cm should be fine, but can we do better than a hard-coded number here?
 
     for (const LArTPCMap::value_type &mapEntry : larTPCMap)
     {
         const LArTPC &checkTPC(*(mapEntry.second));
 
-        if (&inputTPC == &checkTPC)
-            continue;
-
-        if (checkPositive != (checkTPC.GetCenterX() > inputTPC.GetCenterX()))
-            continue;
-
-        const float deltaX(std::fabs(checkTPC.GetCenterX() - inputTPC.GetCenterX()));
-        const float deltaY(std::fabs(checkTPC.GetCenterY() - inputTPC.GetCenterY()));
-        const float deltaZ(std::fabs(checkTPC.GetCenterZ() - inputTPC.GetCenterZ()));
+        float deltaX(std::numeric_limits<float>::max());
 
-        if (deltaY > maxDisplacement || deltaZ > maxDisplacement)
+        if (!LArStitchingHelper::IsClosestTPCCandidate(inputTPC, checkTPC, checkPositive, deltaX))
             continue;
 
         if (deltaX < closestSeparation)
@@ -293,4 +285,166 @@ bool LArStitchingHelper::SortTPCs(const pandora::LArTPC *const pLhs, const pando
     return (pLhs->GetCenterZ() < pRhs->GetCenterZ());
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArStitchingHelper::IsClosestTPCCandidate(const LArTPC &inputTPC, const LArTPC &checkTPC, const bool checkPositive, float &deltaX)
+{
+    if (&inputTPC == &checkTPC)
+        return false;
+
+    if (checkPositive != (checkTPC.GetCenterX() > inputTPC.GetCenterX()))
+        return false;
+
+    const float maxDisplacement(30.f); // TODO: 30cm should be fine, but can we do better than a hard-coded number here?
+    const float deltaY(std::fabs(checkTPC.GetCenterY() - inputTPC.GetCenterY()));
+    const float deltaZ(std::fabs(checkTPC.GetCenterZ() - inputTPC.GetCenterZ()));
+
+    if (deltaY > maxDisplacement || deltaZ > maxDisplacement)
+        return false;
+
+    deltaX = std::fabs(checkTPC.GetCenterX() - inputTPC.GetCenterX());
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArStitchingHelper::TPCBoundary::TPCBoundary(const float centerX, const float widthX) :
+    m_centerX(centerX),
+    m_widthX(widthX)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArStitchingHelper::TPCAdjacencyGraph::TPCAdjacencyGraph(const LArTPCVector &larTPCVector) :
+    m_larTPCVector(larTPCVector)
+{
+    // ATTN Closest tpcs are sought in volume id order, so that ties are resolved as when scanning the LArTPCMap
+    LArTPCVector volumeOrderedTPCs(larTPCVector);
+    std::sort(volumeOrderedTPCs.begin(), volumeOrderedTPCs.end(), [](const LArTPC *const pLhs, const LArTPC *const pRhs)
+        {return (pLhs->GetLArTPCVolumeId() < pRhs->GetLArTPCVolumeId());});
+
+    for (const LArTPC *const pLArTPC1 : larTPCVector)
+    {
+        TPCEntry &tpcEntry(m_tpcEntryMap[pLArTPC1]);
+        float closestPositiveSeparation(std::numeric_limits<float>::max()), closestNegativeSeparation(std::numeric_limits<float>::max());
+
+        for (const LArTPC *const pLArTPC2 : volumeOrderedTPCs)
+        {
+            float deltaX(std::numeric_limits<float>::max());
+
+            if (LArStitchingHelper::IsClosestTPCCandidate(*pLArTPC1, *pLArTPC2, true, deltaX) && (deltaX < closestPositiveSeparation))
+            {
+                closestPositiveSeparation = deltaX;
+                tpcEntry.m_pClosestPositiveTPC = pLArTPC2;
+            }
+
+            if (LArStitchingHelper::IsClosestTPCCandidate(*pLArTPC1, *pLArTPC2, false, deltaX) && (deltaX < closestNegativeSeparation))
+            {
+                closestNegativeSeparation = deltaX;
+                tpcEntry.m_pClosestNegativeTPC = pLArTPC2;
+            }
+        }
+
+        for (const LArTPC *const pLArTPC2 : larTPCVector)
+        {
+            if (!LArStitchingHelper::AreTPCsAdjacent(*pLArTPC1, *pLArTPC2))
+                continue;
+
+            (void) tpcEntry.m_boundaryMap.insert(TPCEntry::TPCToBoundaryMap::value_type(pLArTPC2,
+                TPCBoundary(LArStitchingHelper::GetTPCBoundaryCenterX(*pLArTPC1, *pLArTPC2), LArStitchingHelper::GetTPCBoundaryWidthX(*pLArTPC1, *pLArTPC2))));
+
+            if (LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
+            {
+                tpcEntry.m_stitchableTPCs.push_back(pLArTPC2);
+                (void) tpcEntry.m_stitchableTPCSet.insert(pLArTPC2);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArTPCVector &LArStitchingHelper::TPCAdjacencyGraph::GetLArTPCs() const
+{
+    return m_larTPCVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArTPC &LArStitchingHelper::TPCAdjacencyGraph::FindClosestTPC(const LArTPC &inputTPC, const bool checkPositive) const
+{
+    const TPCEntry &tpcEntry(this->GetTPCEntry(inputTPC));
+    const LArTPC *const pClosestTPC(checkPositive ? tpcEntry.m_pClosestPositiveTPC : tpcEntry.m_pClosestNegativeTPC);
+
+    if (!pClosestTPC)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return (*pClosestTPC);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArStitchingHelper::TPCAdjacencyGraph::AreTPCsAdjacent(const LArTPC &firstTPC, const LArTPC &secondTPC) const
+{
+    const TPCEntry &firstEntry(this->GetTPCEntry(firstTPC));
+    const TPCEntry &secondEntry(this->GetTPCEntry(secondTPC));
+
+    // Check if first tpc is just upstream of second tpc, or second tpc is just upstream of first tpc
+    if ((&firstTPC == secondEntry.m_pClosestPositiveTPC) && (&secondTPC == firstEntry.m_pClosestNegativeTPC))
+        return true;
+
+    return ((&firstTPC == secondEntry.m_pClosestNegativeTPC) && (&secondTPC == firstEntry.m_pClosestPositiveTPC));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArStitchingHelper::TPCAdjacencyGraph::CanTPCsBeStitched(const LArTPC &firstTPC, const LArTPC &secondTPC) const
+{
+    return (this->GetTPCEntry(firstTPC).m_stitchableTPCSet.count(&secondTPC) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArTPCVector &LArStitchingHelper::TPCAdjacencyGraph::GetStitchableTPCs(const LArTPC &larTPC) const
+{
+    return this->GetTPCEntry(larTPC).m_stitchableTPCs;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArStitchingHelper::TPCBoundary &LArStitchingHelper::TPCAdjacencyGraph::GetTPCBoundary(const LArTPC &firstTPC, const LArTPC &secondTPC) const
+{
+    const TPCEntry::TPCToBoundaryMap &boundaryMap(this->GetTPCEntry(firstTPC).m_boundaryMap);
+    TPCEntry::TPCToBoundaryMap::const_iterator iter(boundaryMap.find(&secondTPC));
+
+    if (boundaryMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArStitchingHelper::TPCAdjacencyGraph::TPCEntry &LArStitchingHelper::TPCAdjacencyGraph::GetTPCEntry(const LArTPC &larTPC) const
+{
+    TPCEntryMap::const_iterator iter(m_tpcEntryMap.find(&larTPC));
+
+    if (m_tpcEntryMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArStitchingHelper::TPCAdjacencyGraph::TPCEntry::TPCEntry() :
+    m_pClosestPositiveTPC(nullptr),
+    m_pClosestNegativeTPC(nullptr)
+{
+}
+
 } // namespace lar_content
@@ -14,6 +14,9 @@
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
+#include <unordered_map>
+#include <unordered_set>
+
 namespace lar_content
 {
 
@@ -23,6 +26,132 @@ namespace lar_content
 class LArStitchingHelper
 {
 public:
+    /**
+     *  @brief  TPCBoundary class
+     */
+    class TPCBoundary
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  centerX the centre in X of the boundary
+         *  @param  widthX the width in X of the boundary
+         */
+        TPCBoundary(const float centerX, const float widthX);
+
+        float       m_centerX;          ///< The centre in X of the boundary
+        float       m_widthX;           ///< The width in X of the boundary
+    };
+
+    /**
+     *  @brief  TPCAdjacencyGraph class, an immutable table of the closest, adjacency, stitching and boundary relationships between tpcs,
+     *          built once for a fixed set of tpcs and answering each query with hash lookups
+     */
+    class TPCAdjacencyGraph
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  larTPCVector the tpcs to include, whose addresses are used to key all queries
+         */
+        TPCAdjacencyGraph(const pandora::LArTPCVector &larTPCVector);
+
+        /**
+         *  @brief  Get the tpcs from which the graph was built
+         *
+         *  @return the tpcs, in the order provided to the constructor
+         */
+        const pandora::LArTPCVector &GetLArTPCs() const;
+
+        /**
+         *  @brief  Find closest tpc to a specified input tpc, as LArStitchingHelper::FindClosestTPC for the tpcs in the graph
+         *
+         *  @param  inputTPC the specified drift volume
+         *  @param  checkPositive look in higher (lower) x positions if this is set to true (false)
+         *
+         *  @return the closest tpc
+         */
+        const pandora::LArTPC &FindClosestTPC(const pandora::LArTPC &inputTPC, const bool checkPositive) const;
+
+        /**
+         *  @brief  Whether a pair of drift volumes are each the closest to the other, as LArStitchingHelper::AreTPCsAdjacent for the tpcs
+         *          in the graph, given a pandora instance
+         *
+         *  @param  firstTPC the first tpc
+         *  @param  secondTPC the second tpc
+         *
+         *  @return boolean
+         */
+        bool AreTPCsAdjacent(const pandora::LArTPC &firstTPC, const pandora::LArTPC &secondTPC) const;
+
+        /**
+         *  @brief  Whether particles from a given pair of tpcs can be stitched together
+         *
+         *  @param  firstTPC the first tpc
+         *  @param  secondTPC the second tpc
+         *
+         *  @return boolean
+         */
+        bool CanTPCsBeStitched(const pandora::LArTPC &firstTPC, const pandora::LArTPC &secondTPC) const;
+
+        /**
+         *  @brief  Get the list of tpcs whose particles can be stitched to those of a given tpc
+         *
+         *  @param  larTPC the tpc
+         *
+         *  @return the list of stitchable tpcs
+         */
+        const pandora::LArTPCVector &GetStitchableTPCs(const pandora::LArTPC &larTPC) const;
+
+        /**
+         *  @brief  Get the boundary between a pair of adjacent tpcs
+         *
+         *  @param  firstTPC the first tpc
+         *  @param  secondTPC the second tpc
+         *
+         *  @return the boundary
+         */
+        const TPCBoundary &GetTPCBoundary(const pandora::LArTPC &firstTPC, const pandora::LArTPC &secondTPC) const;
+
+    private:
+        /**
+         *  @brief  TPCEntry class, the relationships of a single tpc to the other tpcs in the graph
+         */
+        class TPCEntry
+        {
+        public:
+            /**
+             *  @brief  Default constructor
+             */
+            TPCEntry();
+
+            typedef std::unordered_map<const pandora::LArTPC*, TPCBoundary> TPCToBoundaryMap;
+            typedef std::unordered_set<const pandora::LArTPC*> LArTPCSet;
+
+            const pandora::LArTPC  *m_pClosestPositiveTPC;      ///< The closest tpc at higher x, if any
+            const pandora::LArTPC  *m_pClosestNegativeTPC;      ///< The closest tpc at lower x, if any
+            TPCToBoundaryMap        m_boundaryMap;              ///< The boundaries with each adjacent tpc
+            pandora::LArTPCVector   m_stitchableTPCs;           ///< The stitchable tpcs, in the order provided to the constructor
+            LArTPCSet               m_stitchableTPCSet;         ///< The stitchable tpcs, for constant time lookup
+        };
+
+        typedef std::unordered_map<const pandora::LArTPC*, TPCEntry> TPCEntryMap;
+
+        /**
+         *  @brief  Get the entry for a tpc in the graph
+         *
+         *  @param  larTPC the tpc
+         *
+         *  @return the entry
+         */
+        const TPCEntry &GetTPCEntry(const pandora::LArTPC &larTPC) const;
+
+        pandora::LArTPCVector       m_larTPCVector;             ///< The tpcs from which the graph was built
+        TPCEntryMap                 m_tpcEntryMap;              ///< The entry for each tpc
+    };
+
    /**
      *  @brief  Find closest tpc to a specified input tpc
      *
@@ -141,6 +270,19 @@ public:
      *  @param  pRhs address of second tpc
      */
     static bool SortTPCs(const pandora::LArTPC *const pLhs, const pandora::LArTPC *const pRhs);
+
+private:
+    /**
+     *  @brief  Whether a candidate tpc could be the closest tpc to an input tpc, in the specified x direction
+     *
+     *  @param  inputTPC the input tpc
+     *  @param  checkTPC the candidate tpc
+     *  @param  checkPositive look in higher (lower) x positions if this is set to true (false)
+     *  @param  deltaX to receive the separation in x of the tpc centres
+     *
+     *  @return boolean
+     */
+    static bool IsClosestTPCCandidate(const pandora::LArTPC &inputTPC, const pandora::LArTPC &checkTPC, const bool checkPositive, float &deltaX);
 };
 
 } // namespace lar_content
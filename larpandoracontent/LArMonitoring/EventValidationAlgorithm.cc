@@ -88,12 +88,16 @@ StatusCode EventValidationAlgorithm::Run()
     const PfoList *pPfoList = nullptr;
     (void) PandoraContentApi::GetList(*this, m_pfoListName, pPfoList);
 
+    // Obtain map: [mc particle -> ancestry]
+    LArMCParticleHelper::MCAncestryMap mcAncestryMap;
+    LArMCParticleHelper::GetMCAncestryMap(pMCParticleList, mcAncestryMap);
+
     // Obtain all reco particles
     PfoList allRecoParticleList(pPfoList ? *pPfoList : PfoList());
 
     // Obtain reco neutrino(s)
     PfoList recoNeutrinoList;
-    this->SelectRecoNeutrinos(allRecoParticleList, recoNeutrinoList);
+    this->SelectRecoNeutrinos(allRecoParticleList, mcAncestryMap, recoNeutrinoList);
     const PfoVector recoNeutrinoVector(recoNeutrinoList.begin(), recoNeutrinoList.end());
 
     // Obtain vector: target pfos
@@ -125,16 +129,10 @@ StatusCode EventValidationAlgorithm::Run()
     LArMonitoringHelper::MCContributionMap mcToTrueHitListMap;
     LArMonitoringHelper::GetMCParticleToCaloHitMatches(&selectedCaloHitList, mcToPrimaryMCMap, hitToPrimaryMCMap, mcToTrueHitListMap);
 
-    // Obtain maps: [hit -> pfo], [pfo -> list of hits]
-    LArMonitoringHelper::CaloHitToPfoMap hitToPfoMap;
-    LArMonitoringHelper::PfoContributionMap pfoToHitListMap;
-    LArMonitoringHelper::GetPfoToCaloHitMatches(&selectedCaloHitList, pfoList, m_collapseToPrimaryPfos, hitToPfoMap, pfoToHitListMap);
-
-    // Obtain maps: [mc particle -> best matched pfo], [mc particle -> list of hits included in best pfo], [mc particle -> all matched pfos (and matched hits)]
-    LArMonitoringHelper::MCToPfoMap mcToBestPfoMap;
-    LArMonitoringHelper::MCContributionMap mcToBestPfoHitsMap;
-    LArMonitoringHelper::MCToPfoMatchingMap mcToFullPfoMatchingMap;
-    LArMonitoringHelper::GetMCParticleToPfoMatches(&selectedCaloHitList, pfoToHitListMap, hitToPrimaryMCMap, mcToBestPfoMap, mcToBestPfoHitsMap, mcToFullPfoMatchingMap);
+    // Obtain maps: [pfo -> numbers of hits], [mc particle -> all matched pfos (and numbers of matched hits)]
+    LArMonitoringHelper::PfoHitCountMap pfoHitCountMap;
+    LArMonitoringHelper::MCToPfoHitCountMatrix mcToPfoHitCountMatrix;
+    LArMonitoringHelper::GetMCParticleToPfoHitCounts(&selectedCaloHitList, pfoList, m_collapseToPrimaryPfos, hitToPrimaryMCMap, pfoHitCountMap, mcToPfoHitCountMatrix);
 
     // Remove shared hits where target particle deposits below threshold energy fraction
     CaloHitList goodCaloHitList;
@@ -147,11 +145,11 @@ StatusCode EventValidationAlgorithm::Run()
 
     // Obtain vector: simple mc primaries
     SimpleMCPrimaryList simpleMCPrimaryList;
-    this->GetSimpleMCPrimaryList(mcPrimaryVector, mcToTrueHitListMap, mcToGoodTrueHitListMap, mcToFullPfoMatchingMap, simpleMCPrimaryList);
+    this->GetSimpleMCPrimaryList(mcPrimaryVector, mcToTrueHitListMap, mcToGoodTrueHitListMap, mcToPfoHitCountMatrix, simpleMCPrimaryList);
 
     // Obtain map: [simple mc primary -> list of simple matched pfos]
     MCPrimaryMatchingMap mcPrimaryMatchingMap;
-    this->GetMCPrimaryMatchingMap(simpleMCPrimaryList, pfoIdMap, mcToFullPfoMatchingMap, pfoToHitListMap, mcPrimaryMatchingMap);
+    this->GetMCPrimaryMatchingMap(simpleMCPrimaryList, pfoIdMap, mcToPfoHitCountMatrix, pfoHitCountMap, mcPrimaryMatchingMap);
 
     // Print raw matching information to terminal
     if (m_printAllToScreen)
@@ -182,7 +180,8 @@ StatusCode EventValidationAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void EventValidationAlgorithm::SelectRecoNeutrinos(const PfoList &allRecoParticleList, PfoList &selectedRecoNeutrinoList) const
+void EventValidationAlgorithm::SelectRecoNeutrinos(const PfoList &allRecoParticleList, const LArMCParticleHelper::MCAncestryMap &mcAncestryMap,
+    PfoList &selectedRecoNeutrinoList) const
 {
     PfoList allRecoNeutrinoList;
     LArPfoHelper::GetRecoNeutrinos(&allRecoParticleList, allRecoNeutrinoList);
@@ -203,7 +202,7 @@ void EventValidationAlgorithm::SelectRecoNeutrinos(const PfoList &allRecoParticl
         LArPfoHelper::GetAllDownstreamPfos(pNeutrinoPfo, downstreamPfos);
 
         float thisNeutrinoWeight(0.f), thisTotalWeight(0.f);
-        LArMCParticleHelper::GetNeutrinoWeight(&downstreamPfos, thisNeutrinoWeight, thisTotalWeight);
+        LArMCParticleHelper::GetNeutrinoWeight(&downstreamPfos, thisNeutrinoWeight, thisTotalWeight, &mcAncestryMap);
 
         if (thisNeutrinoWeight > bestNeutrinoWeight)
         {
@@ -219,7 +218,7 @@ void EventValidationAlgorithm::SelectRecoNeutrinos(const PfoList &allRecoParticl
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void EventValidationAlgorithm::GetSimpleMCPrimaryList(const MCParticleVector &mcPrimaryVector, const LArMonitoringHelper::MCContributionMap &mcToTrueHitListMap,
-    const LArMonitoringHelper::MCContributionMap &mcToGoodTrueHitListMap, const LArMonitoringHelper::MCToPfoMatchingMap &mcToFullPfoMatchingMap,
+    const LArMonitoringHelper::MCContributionMap &mcToGoodTrueHitListMap, const LArMonitoringHelper::MCToPfoHitCountMatrix &mcToPfoHitCountMatrix,
     SimpleMCPrimaryList &simpleMCPrimaryList) const
 {
     for (const MCParticle *const pMCPrimary : mcPrimaryVector)
@@ -258,9 +257,9 @@ void EventValidationAlgorithm::GetSimpleMCPrimaryList(const MCParticleVector &mc
             simpleMCPrimary.m_nGoodMCHitsW = LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, caloHitList);
         }
 
-        LArMonitoringHelper::MCToPfoMatchingMap::const_iterator matchedPfoIter = mcToFullPfoMatchingMap.find(pMCPrimary);
+        LArMonitoringHelper::MCToPfoHitCountMatrix::const_iterator matchedPfoIter = mcToPfoHitCountMatrix.find(pMCPrimary);
 
-        if (mcToFullPfoMatchingMap.end() != matchedPfoIter)
+        if (mcToPfoHitCountMatrix.end() != matchedPfoIter)
             simpleMCPrimary.m_nMatchedPfos = matchedPfoIter->second.size();
 
         simpleMCPrimaryList.push_back(simpleMCPrimary);
@@ -276,21 +275,21 @@ void EventValidationAlgorithm::GetSimpleMCPrimaryList(const MCParticleVector &mc
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void EventValidationAlgorithm::GetMCPrimaryMatchingMap(const SimpleMCPrimaryList &simpleMCPrimaryList, const PfoIdMap &pfoIdMap,
-    const LArMonitoringHelper::MCToPfoMatchingMap &mcToFullPfoMatchingMap, const LArMonitoringHelper::PfoContributionMap &pfoToHitListMap,
+    const LArMonitoringHelper::MCToPfoHitCountMatrix &mcToPfoHitCountMatrix, const LArMonitoringHelper::PfoHitCountMap &pfoHitCountMap,
     MCPrimaryMatchingMap &mcPrimaryMatchingMap) const
 {
     for (const SimpleMCPrimary &simpleMCPrimary : simpleMCPrimaryList)
     {
         // First loop over unordered list of matched pfos
         SimpleMatchedPfoList simpleMatchedPfoList;
-        LArMonitoringHelper::MCToPfoMatchingMap::const_iterator matchedPfoIter = mcToFullPfoMatchingMap.find(simpleMCPrimary.m_pPandoraAddress);
+        LArMonitoringHelper::MCToPfoHitCountMatrix::const_iterator matchedPfoIter = mcToPfoHitCountMatrix.find(simpleMCPrimary.m_pPandoraAddress);
 
-        if (mcToFullPfoMatchingMap.end() != matchedPfoIter)
+        if (mcToPfoHitCountMatrix.end() != matchedPfoIter)
         {
-            for (const LArMonitoringHelper::PfoContributionMap::value_type contribution : matchedPfoIter->second)
+            for (const LArMonitoringHelper::PfoHitCountMap::value_type &contribution : matchedPfoIter->second)
             {
                 const ParticleFlowObject *const pMatchedPfo(contribution.first);
-                const CaloHitList &matchedCaloHitList(contribution.second);
+                const LArMonitoringHelper::HitCounts &matchedHitCounts(contribution.second);
 
                 SimpleMatchedPfo simpleMatchedPfo;
                 simpleMatchedPfo.m_pPandoraAddress = pMatchedPfo;
@@ -304,22 +303,22 @@ void EventValidationAlgorithm::GetMCPrimaryMatchingMap(const SimpleMCPrimaryList
 
                 simpleMatchedPfo.m_pdgCode = pMatchedPfo->GetParticleId();
 
-                simpleMatchedPfo.m_nMatchedHitsTotal = matchedCaloHitList.size();
-                simpleMatchedPfo.m_nMatchedHitsU = LArMonitoringHelper::CountHitsByType(TPC_VIEW_U, matchedCaloHitList);
-                simpleMatchedPfo.m_nMatchedHitsV = LArMonitoringHelper::CountHitsByType(TPC_VIEW_V, matchedCaloHitList);
-                simpleMatchedPfo.m_nMatchedHitsW = LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, matchedCaloHitList);
+                simpleMatchedPfo.m_nMatchedHitsTotal = matchedHitCounts.m_nHitsTotal;
+                simpleMatchedPfo.m_nMatchedHitsU = matchedHitCounts.m_nHitsU;
+                simpleMatchedPfo.m_nMatchedHitsV = matchedHitCounts.m_nHitsV;
+                simpleMatchedPfo.m_nMatchedHitsW = matchedHitCounts.m_nHitsW;
 
-                LArMonitoringHelper::PfoContributionMap::const_iterator pfoHitsIter = pfoToHitListMap.find(pMatchedPfo);
+                LArMonitoringHelper::PfoHitCountMap::const_iterator pfoHitsIter = pfoHitCountMap.find(pMatchedPfo);
 
-                if (pfoToHitListMap.end() == pfoHitsIter)
+                if (pfoHitCountMap.end() == pfoHitsIter)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
 
-                const CaloHitList &pfoCaloHitList(pfoHitsIter->second);
+                const LArMonitoringHelper::HitCounts &pfoHitCounts(pfoHitsIter->second);
 
-                simpleMatchedPfo.m_nPfoHitsTotal = pfoCaloHitList.size();
-                simpleMatchedPfo.m_nPfoHitsU = LArMonitoringHelper::CountHitsByType(TPC_VIEW_U, pfoCaloHitList);
-                simpleMatchedPfo.m_nPfoHitsV = LArMonitoringHelper::CountHitsByType(TPC_VIEW_V, pfoCaloHitList);
-                simpleMatchedPfo.m_nPfoHitsW = LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, pfoCaloHitList);
+                simpleMatchedPfo.m_nPfoHitsTotal = pfoHitCounts.m_nHitsTotal;
+                simpleMatchedPfo.m_nPfoHitsU = pfoHitCounts.m_nHitsU;
+                simpleMatchedPfo.m_nPfoHitsV = pfoHitCounts.m_nHitsV;
+                simpleMatchedPfo.m_nPfoHitsW = pfoHitCounts.m_nHitsW;
 
                 try {simpleMatchedPfo.m_vertex = LArPfoHelper::GetVertex(pMatchedPfo)->GetPosition();}
                 catch (const StatusCodeException &) {}
@@ -136,9 +136,11 @@ private:
      *          integrate over all neutrino daughter particles, regardless of neutrino origin)
      *
      *  @param  allRecoParticleList the list of all reco particles
+     *  @param  mcAncestryMap the mc particle to ancestry map
      *  @param  selectedRecoNeutrinoList to receive the populated selected reco neutrino list
      */
-    void SelectRecoNeutrinos(const pandora::PfoList &allRecoParticleList, pandora::PfoList &selectedRecoNeutrinoList) const;
+    void SelectRecoNeutrinos(const pandora::PfoList &allRecoParticleList, const LArMCParticleHelper::MCAncestryMap &mcAncestryMap,
+        pandora::PfoList &selectedRecoNeutrinoList) const;
 
     /**
      *  @brief  Extract details of each mc primary (ordered by number of true hits)
@@ -146,11 +148,11 @@ private:
      *  @param  mcPrimaryList the mc primary list
      *  @param  mcToTrueHitListMap the mc to true hit list map
      *  @param  mcToGoodTrueHitListMap the mc to good true hit list map (vetoes hits with significant energy sharing)
-     *  @param  mcToFullPfoMatchingMap the mc to full pfo matching map (to record number of matched pfos)
+     *  @param  mcToPfoHitCountMatrix the mc to pfo shared hit count matrix (to record number of matched pfos)
      *  @param  simpleMCPrimaryList to receive the populated simple mc primary list
      */
     void GetSimpleMCPrimaryList(const pandora::MCParticleVector &mcPrimaryList, const LArMonitoringHelper::MCContributionMap &mcToTrueHitListMap,
-        const LArMonitoringHelper::MCContributionMap &mcToGoodTrueHitListMap, const LArMonitoringHelper::MCToPfoMatchingMap &mcToFullPfoMatchingMap,
+        const LArMonitoringHelper::MCContributionMap &mcToGoodTrueHitListMap, const LArMonitoringHelper::MCToPfoHitCountMatrix &mcToPfoHitCountMatrix,
         SimpleMCPrimaryList &simpleMCPrimaryList) const;
 
     typedef std::unordered_map<const pandora::ParticleFlowObject*, int> PfoIdMap;
@@ -161,12 +163,12 @@ private:
      *
      *  @param  simpleMCPrimaryList the simple mc primary list
      *  @param  pfoIdMap the pfo id map
-     *  @param  mcToFullPfoMatchingMap the mc to full pfo matching map
-     *  @param  pfoToHitListMap the pfo to hit list map
+     *  @param  mcToPfoHitCountMatrix the mc to pfo shared hit count matrix
+     *  @param  pfoHitCountMap the pfo to hit count map
      *  @param  mcPrimaryMatchingMap to receive the populated mc primary matching map
      */
     void GetMCPrimaryMatchingMap(const SimpleMCPrimaryList &simpleMCPrimaryList, const PfoIdMap &pfoIdMap,
-        const LArMonitoringHelper::MCToPfoMatchingMap &mcToFullPfoMatchingMap, const LArMonitoringHelper::PfoContributionMap &pfoToHitListMap,
+        const LArMonitoringHelper::MCToPfoHitCountMatrix &mcToPfoHitCountMatrix, const LArMonitoringHelper::PfoHitCountMap &pfoHitCountMap,
         MCPrimaryMatchingMap &mcPrimaryMatchingMap) const;
 
     /**
@@ -64,6 +64,35 @@ float SimpleCone::GetBoundedHitFraction(const Cluster *const pCluster, const flo
     return ((nClusterHits > 0) ? static_cast<float>(nMatchedHits) / static_cast<float>(nClusterHits) : 0.f);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SimpleCone::GetBoundedHitFractions(const CartesianPointVector &hitPositionVector, const float coneLength, const float coneTanHalfAngle1,
+    const float coneTanHalfAngle2, float &boundedFraction1, float &boundedFraction2) const
+{
+    unsigned int nMatchedHits1(0), nMatchedHits2(0);
+    const unsigned int nHits(hitPositionVector.size());
+
+    for (const CartesianVector &hitPosition : hitPositionVector)
+    {
+        const CartesianVector displacement(hitPosition - this->GetConeApex());
+        const float rL(displacement.GetDotProduct(this->GetConeDirection()));
+
+        if ((rL < 0.f) || (rL > coneLength))
+            continue;
+
+        const float rT(displacement.GetCrossProduct(this->GetConeDirection()).GetMagnitude());
+
+        if (rL * coneTanHalfAngle1 > rT)
+            ++nMatchedHits1;
+
+        if (rL * coneTanHalfAngle2 > rT)
+            ++nMatchedHits2;
+    }
+
+    boundedFraction1 = ((nHits > 0) ? static_cast<float>(nMatchedHits1) / static_cast<float>(nHits) : 0.f);
+    boundedFraction2 = ((nHits > 0) ? static_cast<float>(nMatchedHits2) / static_cast<float>(nHits) : 0.f);
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
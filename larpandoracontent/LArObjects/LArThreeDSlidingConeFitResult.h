@@ -103,6 +103,20 @@ public:
      */
     float GetBoundedHitFraction(const pandora::Cluster *const pCluster, const float coneLength, const float coneTanHalfAngle) const;
 
+    /**
+     *  @brief  Get the fractions of hits in a provided list of hit positions that are bounded within the cone, using a provided cone length
+     *          and two provided cone angles, in a single pass over the hits
+     * 
+     *  @param  hitPositionVector the hit positions, e.g. for all hits in a cluster
+     *  @param  coneLength the provided cone length
+     *  @param  coneTanHalfAngle1 the first provided tangent of the cone half-angle
+     *  @param  coneTanHalfAngle2 the second provided tangent of the cone half-angle
+     *  @param  boundedFraction1 to receive the bounded hit fraction for the first cone half-angle
+     *  @param  boundedFraction2 to receive the bounded hit fraction for the second cone half-angle
+     */
+    void GetBoundedHitFractions(const pandora::CartesianPointVector &hitPositionVector, const float coneLength, const float coneTanHalfAngle1,
+        const float coneTanHalfAngle2, float &boundedFraction1, float &boundedFraction2) const;
+
 private:
     pandora::CartesianVector        m_coneApex;                 ///< The cone apex
     pandora::CartesianVector        m_coneDirection;            ///< The cone direction
@@ -17,6 +17,8 @@
 #include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
 
 #include <algorithm>
+#include <fstream>
+#include <vector>
 
 using namespace pandora;
 
@@ -27,7 +29,9 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
     m_skipToEvent(0),
     m_useLArCaloHits(true),
     m_useLArMCParticles(true),
-    m_pEventFileReader(nullptr)
+    m_pEventFileReader(nullptr),
+    m_filePrefetchDepth(0),
+    m_stopFilePrefetch(false)
 {
 }
 
@@ -35,6 +39,7 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
 
 EventReadingAlgorithm::~EventReadingAlgorithm()
 {
+    this->StopFilePrefetch();
     delete m_pEventFileReader;
 }
 
@@ -66,6 +71,7 @@ StatusCode EventReadingAlgorithm::Initialize()
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->GoToEvent(m_skipToEvent));
+        this->StartFilePrefetch();
     }
 
     return STATUS_CODE_SUCCESS;
@@ -102,6 +108,7 @@ void EventReadingAlgorithm::MoveToNextEventFile()
     m_eventFileName = m_eventFileNameVector.back();
     m_eventFileNameVector.pop_back();
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
+    this->StartFilePrefetch();
 
     try
     {
@@ -147,6 +154,58 @@ StatusCode EventReadingAlgorithm::ReplaceEventFileReader(const std::string &file
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EventReadingAlgorithm::StartFilePrefetch()
+{
+    this->StopFilePrefetch();
+
+    if ((0 == m_filePrefetchDepth) || m_eventFileNameVector.empty())
+        return;
+
+    // ATTN Remaining file names are stored in reverse order, with the next file to be processed at the back
+    StringVector fileNameVector;
+
+    for (StringVector::const_reverse_iterator iter = m_eventFileNameVector.rbegin(), iterEnd = m_eventFileNameVector.rend();
+        (iter != iterEnd) && (fileNameVector.size() < m_filePrefetchDepth); ++iter)
+    {
+        fileNameVector.push_back(*iter);
+    }
+
+    m_stopFilePrefetch = false;
+    m_filePrefetchThread = std::thread(&EventReadingAlgorithm::PrefetchEventFiles, fileNameVector, &m_stopFilePrefetch);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::StopFilePrefetch()
+{
+    if (!m_filePrefetchThread.joinable())
+        return;
+
+    m_stopFilePrefetch = true;
+    m_filePrefetchThread.join();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::PrefetchEventFiles(const StringVector fileNameVector, const std::atomic<bool> *const pStopFilePrefetch)
+{
+    // ATTN Only reads raw file contents; all pandora object creation remains with the event file readers on the calling thread
+    std::vector<char> buffer(1 << 20);
+
+    for (const std::string &fileName : fileNameVector)
+    {
+        std::ifstream fileStream(fileName.c_str(), std::ios::in | std::ios::binary);
+
+        while (fileStream.good() && !(*pStopFilePrefetch))
+            fileStream.read(buffer.data(), buffer.size());
+
+        if (*pStopFilePrefetch)
+            return;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 FileType EventReadingAlgorithm::GetFileType(const std::string &fileName) const
 {
     std::string fileExtension(fileName.substr(fileName.find_last_of(".")));
@@ -227,6 +286,9 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "UseLArMCParticles", m_useLArMCParticles));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "EventFilePrefetchDepth", m_filePrefetchDepth));
+
     return STATUS_CODE_SUCCESS;
 }
 
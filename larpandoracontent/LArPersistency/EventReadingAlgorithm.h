@@ -14,6 +14,9 @@
 
 #include "Persistency/PandoraIO.h"
 
+#include <atomic>
+#include <thread>
+
 namespace pandora {class FileReader;}
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -64,6 +67,27 @@ private:
      */
     pandora::StatusCode ReplaceEventFileReader(const std::string &fileName);
 
+    /**
+     *  @brief  Start a background thread to prefetch the next event files named in the input list, bringing them into the
+     *          operating system file cache before the event file readers reach them. Any existing prefetch is first stopped.
+     *          This works at file granularity: events are still decoded one at a time, and the events of the current file
+     *          are not staged.
+     */
+    void StartFilePrefetch();
+
+    /**
+     *  @brief  Stop any background file prefetch, waiting for the thread to finish
+     */
+    void StopFilePrefetch();
+
+    /**
+     *  @brief  Read the contents of the specified files, discarding the data, until complete or until asked to stop
+     *
+     *  @param  fileNameVector the file names, in the order in which they will be processed
+     *  @param  pStopFilePrefetch address of the flag indicating that the prefetch should stop
+     */
+    static void PrefetchEventFiles(const pandora::StringVector fileNameVector, const std::atomic<bool> *const pStopFilePrefetch);
+
     /**
      *  @brief  Analyze a provided file name to extract the file type/extension
      *
@@ -85,6 +109,10 @@ private:
     bool                        m_useLArMCParticles;            ///< Whether to read lar mc particles, or standard pandora mc particles
 
     pandora::FileReader        *m_pEventFileReader;             ///< Address of the event file reader
+
+    unsigned int                m_filePrefetchDepth;            ///< Number of upcoming event files to prefetch in the background (0 to disable)
+    std::thread                 m_filePrefetchThread;           ///< The background file prefetch thread
+    std::atomic<bool>           m_stopFilePrefetch;             ///< Whether the background file prefetch thread should stop
 };
 
 } // namespace lar_content
@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 
+#include <limits>
+
 using namespace pandora;
 
 namespace lar_content
@@ -48,6 +50,13 @@ StatusCode CosmicRayBaseMatchingAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CosmicRayBaseMatchingAlgorithm::GetMaxXGap() const
+{
+    return std::numeric_limits<float>::max();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CosmicRayBaseMatchingAlgorithm::GetAvailableClusters(const std::string inputClusterListName, ClusterVector &clusterVector) const
 {
     const ClusterList *pClusterList = NULL;
@@ -90,10 +99,67 @@ void CosmicRayBaseMatchingAlgorithm::MatchClusters(const ClusterVector &clusterV
     if (hitType1 == hitType2)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
+    const float maxXGap(this->GetMaxXGap());
+
+    if (!(maxXGap < std::numeric_limits<float>::max()))
+    {
+        for (const Cluster *const pCluster1 : clusterVector1)
+        {
+            for (const Cluster *const pCluster2 : clusterVector2)
+            {
+                if (this->MatchClusters(pCluster1, pCluster2))
+                {
+                    matchedClusters12[pCluster1].push_back(pCluster2);
+                }
+            }
+        }
+
+        return;
+    }
+
+    // Order the clusters from the second view by x span, so that only pairs of clusters with nearby x spans are tested
+    // ATTN Padding is conservative, so that no matching pair of clusters is ever excluded by floating point rounding
+    const float padding(1.01f * std::max(0.f, maxXGap) + 0.1f);
+
+    FloatVector xMaxVector2;
+    std::vector<std::pair<float, unsigned int>> sortedIndices2;
+
+    for (unsigned int index2 = 0; index2 < clusterVector2.size(); ++index2)
+    {
+        float xMin2(0.f), xMax2(0.f);
+        LArClusterHelper::GetClusterSpanX(clusterVector2.at(index2), xMin2, xMax2);
+
+        xMaxVector2.push_back(xMax2);
+        sortedIndices2.push_back(std::make_pair(xMin2, index2));
+    }
+
+    std::sort(sortedIndices2.begin(), sortedIndices2.end());
+
     for (const Cluster *const pCluster1 : clusterVector1)
     {
-        for (const Cluster *const pCluster2 : clusterVector2)
+        float xMin1(0.f), xMax1(0.f);
+        LArClusterHelper::GetClusterSpanX(pCluster1, xMin1, xMax1);
+
+        std::vector<unsigned int> candidateIndices;
+
+        for (const auto &sortedIndex : sortedIndices2)
+        {
+            if (sortedIndex.first > xMax1 + padding)
+                break;
+
+            if (xMaxVector2.at(sortedIndex.second) < xMin1 - padding)
+                continue;
+
+            candidateIndices.push_back(sortedIndex.second);
+        }
+
+        // ATTN Preserve the original order of matches, which determines the order of the output particles
+        std::sort(candidateIndices.begin(), candidateIndices.end());
+
+        for (const unsigned int index2 : candidateIndices)
         {
+            const Cluster *const pCluster2(clusterVector2.at(index2));
+
             if (this->MatchClusters(pCluster1, pCluster2))
             {
                 matchedClusters12[pCluster1].push_back(pCluster2);
@@ -112,6 +178,11 @@ void CosmicRayBaseMatchingAlgorithm::MatchThreeViews(const ClusterAssociationMap
 
     ParticleList candidateParticles;
 
+    ClusterToClustersMap matchedClusterSets31;
+
+    for (const auto &mapEntry : matchedClusters31)
+        matchedClusterSets31[mapEntry.first].insert(mapEntry.second.begin(), mapEntry.second.end());
+
     ClusterList clusterList1;
     for (const auto &mapEntry : matchedClusters12) clusterList1.push_back(mapEntry.first);
     clusterList1.sort(LArClusterHelper::SortByNHits);
@@ -131,12 +202,12 @@ void CosmicRayBaseMatchingAlgorithm::MatchThreeViews(const ClusterAssociationMap
 
             for (const Cluster *const pCluster3 : clusterList3)
             {
-                ClusterAssociationMap::const_iterator iter31 = matchedClusters31.find(pCluster3);
+                ClusterToClustersMap::const_iterator iter31 = matchedClusterSets31.find(pCluster3);
 
-                if (matchedClusters31.end() == iter31)
+                if (matchedClusterSets31.end() == iter31)
                     continue;
 
-                if (iter31->second.end() == std::find(iter31->second.begin(), iter31->second.end(), pCluster1))
+                if (!iter31->second.count(pCluster1))
                     continue;
 
                 const HitType hitType1(LArClusterHelper::GetClusterHitType(pCluster1));
@@ -204,32 +275,48 @@ void CosmicRayBaseMatchingAlgorithm::MatchTwoViews(const ClusterAssociationMap &
 
 void CosmicRayBaseMatchingAlgorithm::ResolveAmbiguities(const ParticleList &candidateParticles, ParticleList &matchedParticles) const
 {
-    for (const Particle &particle1 : candidateParticles)
+    // ATTN A candidate particle is ambiguous if any of its clusters is also used by a different candidate particle
+    ClusterToParticleMap clusterToParticleMap;
+    ClusterSet ambiguousClusters;
+
+    for (const Particle &particle : candidateParticles)
     {
-        bool isGoodMatch(true);
+        this->AddClusterUsage(particle.m_pClusterU, particle, clusterToParticleMap, ambiguousClusters);
+        this->AddClusterUsage(particle.m_pClusterV, particle, clusterToParticleMap, ambiguousClusters);
+        this->AddClusterUsage(particle.m_pClusterW, particle, clusterToParticleMap, ambiguousClusters);
+    }
 
-        for (const Particle &particle2 : candidateParticles)
+    for (const Particle &particle : candidateParticles)
+    {
+        if (ambiguousClusters.count(particle.m_pClusterU) || ambiguousClusters.count(particle.m_pClusterV) ||
+            ambiguousClusters.count(particle.m_pClusterW))
         {
-            const bool commonU(particle1.m_pClusterU == particle2.m_pClusterU);
-            const bool commonV(particle1.m_pClusterV == particle2.m_pClusterV);
-            const bool commonW(particle1.m_pClusterW == particle2.m_pClusterW);
+            continue;
+        }
+
+        matchedParticles.push_back(particle);
+    }
+}
 
-            const bool ambiguousU(commonU && NULL != particle1.m_pClusterU);
-            const bool ambiguousV(commonV && NULL != particle1.m_pClusterV);
-            const bool ambiguousW(commonW && NULL != particle1.m_pClusterW);
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-            if (commonU && commonV && commonW)
-                continue;
+void CosmicRayBaseMatchingAlgorithm::AddClusterUsage(const Cluster *const pCluster, const Particle &particle,
+    ClusterToParticleMap &clusterToParticleMap, ClusterSet &ambiguousClusters) const
+{
+    if (NULL == pCluster)
+        return;
 
-            if (ambiguousU || ambiguousV || ambiguousW)
-            {
-                isGoodMatch = false;
-                break;
-            }
-        }
+    const auto insertResult(clusterToParticleMap.insert(ClusterToParticleMap::value_type(pCluster, &particle)));
 
-        if (isGoodMatch)
-            matchedParticles.push_back(particle1);
+    if (insertResult.second)
+        return;
+
+    const Particle *const pFirstParticle(insertResult.first->second);
+
+    if ((pFirstParticle->m_pClusterU != particle.m_pClusterU) || (pFirstParticle->m_pClusterV != particle.m_pClusterV) ||
+        (pFirstParticle->m_pClusterW != particle.m_pClusterW))
+    {
+        (void) ambiguousClusters.insert(pCluster);
     }
 }
 
@@ -66,6 +66,14 @@ protected:
      */
     virtual bool MatchClusters(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2) const = 0;
 
+    /**
+     *  @brief Get the maximum gap between the x spans of a pair of clusters for which MatchClusters can succeed, used to skip pairs
+     *         of clusters that are well separated in x. The default, the maximum float value, disables this pre-selection.
+     *
+     *  @return the maximum x gap
+     */
+    virtual float GetMaxXGap() const;
+
     /**
      *  @brief Check that three clusters have a consistent 3D position
      *
@@ -88,6 +96,9 @@ protected:
         PandoraContentApi::ParticleFlowObject::Parameters &pfoParameters) const = 0;
 
 private:
+    typedef std::unordered_map<const pandora::Cluster*, pandora::ClusterSet> ClusterToClustersMap;
+    typedef std::unordered_map<const pandora::Cluster*, const Particle*> ClusterToParticleMap;
+
     /**
      *  @brief Get a vector of available clusters
      *
@@ -148,6 +159,17 @@ private:
      */
     void ResolveAmbiguities(const ParticleList &inputList, ParticleList &outputList) const;
 
+    /**
+     *  @brief Record the use of a cluster by a candidate particle, identifying clusters used by two different candidate particles
+     *
+     *  @param pCluster the cluster, which may be null
+     *  @param particle the candidate particle
+     *  @param clusterToParticleMap the map from each cluster to the first candidate particle using it
+     *  @param ambiguousClusters the set of clusters used by more than one different candidate particle
+     */
+    void AddClusterUsage(const pandora::Cluster *const pCluster, const Particle &particle, ClusterToParticleMap &clusterToParticleMap,
+        pandora::ClusterSet &ambiguousClusters) const;
+
     /**
      *  @brief Build PFO objects from candidate particles
      *
@@ -61,6 +61,13 @@ bool CosmicRayShowerMatchingAlgorithm::MatchClusters(const Cluster *const pClust
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CosmicRayShowerMatchingAlgorithm::GetMaxXGap() const
+{
+    return -m_minXOverlap;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool CosmicRayShowerMatchingAlgorithm::CheckMatchedClusters3D(const Cluster *const pCluster1, const Cluster *const pCluster2,
     const Cluster *const pCluster3) const
 {
@@ -111,6 +111,14 @@ bool CosmicRayTrackMatchingAlgorithm::MatchClusters(const Cluster *const pCluste
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CosmicRayTrackMatchingAlgorithm::GetMaxXGap() const
+{
+    // ATTN Matches require either nearby start/end positions, or a sufficient x overlap
+    return std::max(m_vtxXOverlap, -m_minXOverlap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool CosmicRayTrackMatchingAlgorithm::CheckMatchedClusters3D(const Cluster *const pCluster1, const Cluster *const pCluster2,
     const Cluster *const pCluster3) const
 {
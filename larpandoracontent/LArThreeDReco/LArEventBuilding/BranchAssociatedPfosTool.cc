@@ -8,7 +8,6 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
-#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
@@ -38,6 +37,8 @@ void BranchAssociatedPfosTool::Run(NeutrinoHierarchyAlgorithm *const pAlgorithm,
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
        std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
+    // ATTN Distances from branch vertices to parent clusters are unchanged between passes, so are calculated once per pfo pair
+    PfoPairDistanceMap parentClusterDistanceMap;
     bool associationsMade(true);
 
     while (associationsMade)
@@ -84,8 +85,18 @@ void BranchAssociatedPfosTool::Run(NeutrinoHierarchyAlgorithm *const pAlgorithm,
                 if (parentIsTrack && (dParentVertex < m_trackBranchAdditionFraction * parentLength3D))
                     continue;
 
-                const float dInnerVertex(LArClusterHelper::GetClosestDistance(pointingCluster.GetInnerVertex().GetPosition(), pParentCluster3D));
-                const float dOuterVertex(LArClusterHelper::GetClosestDistance(pointingCluster.GetOuterVertex().GetPosition(), pParentCluster3D));
+                const PfoPair pfoPair(pParentPfo, pPfo);
+                PfoPairDistanceMap::const_iterator distanceIter(parentClusterDistanceMap.find(pfoPair));
+
+                if (parentClusterDistanceMap.end() == distanceIter)
+                {
+                    const float dInner(pAlgorithm->GetClosestDistance(pointingCluster.GetInnerVertex().GetPosition(), pParentCluster3D, m_maxParentClusterDistance));
+                    const float dOuter(pAlgorithm->GetClosestDistance(pointingCluster.GetOuterVertex().GetPosition(), pParentCluster3D, m_maxParentClusterDistance));
+                    distanceIter = parentClusterDistanceMap.insert(PfoPairDistanceMap::value_type(pfoPair, std::make_pair(dInner, dOuter))).first;
+                }
+
+                const float dInnerVertex(distanceIter->second.first);
+                const float dOuterVertex(distanceIter->second.second);
 
                 if ((dInnerVertex < m_maxParentClusterDistance) || (dOuterVertex < m_maxParentClusterDistance))
                 {
@@ -10,6 +10,8 @@
 
 #include "larpandoracontent/LArThreeDReco/LArEventBuilding/NeutrinoHierarchyAlgorithm.h"
 
+#include <map>
+
 namespace lar_content
 {
 
@@ -27,6 +29,9 @@ public:
     void Run(NeutrinoHierarchyAlgorithm *const pAlgorithm, const pandora::Vertex *const pNeutrinoVertex, NeutrinoHierarchyAlgorithm::PfoInfoMap &pfoInfoMap);
 
 private:
+    typedef std::pair<const pandora::ParticleFlowObject*, const pandora::ParticleFlowObject*> PfoPair;
+    typedef std::map<PfoPair, std::pair<float, float> > PfoPairDistanceMap;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     float       m_minNeutrinoVertexDistance;        ///< Branch association: min distance from branch vertex to neutrino vertex
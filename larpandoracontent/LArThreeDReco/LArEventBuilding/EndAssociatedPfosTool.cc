@@ -40,6 +40,8 @@ void EndAssociatedPfosTool::Run(NeutrinoHierarchyAlgorithm *const pAlgorithm, co
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
        std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
+    // ATTN Closest positions between parent and daughter clusters are unchanged between passes, so are calculated once per pfo pair
+    ClosestPositionsMap closestPositionsMap;
     bool associationsMade(true);
 
     while (associationsMade)
@@ -82,7 +84,7 @@ void EndAssociatedPfosTool::Run(NeutrinoHierarchyAlgorithm *const pAlgorithm, co
                     LArPointingClusterHelper::IsNode(daughterVertex.GetPosition(), parentEndpoint, m_minVertexLongitudinalDistance, m_maxVertexTransverseDistance) ||
                     LArPointingClusterHelper::IsEmission(parentEndpoint.GetPosition(), daughterVertex, m_minVertexLongitudinalDistance, m_maxVertexLongitudinalDistance, m_maxVertexTransverseDistance, m_vertexAngularAllowance) ||
                     LArPointingClusterHelper::IsEmission(daughterVertex.GetPosition(), parentEndpoint, m_minVertexLongitudinalDistance, m_maxVertexLongitudinalDistance, m_maxVertexTransverseDistance, m_vertexAngularAllowance) ||
-                    this->IsCloseToParentEndpoint(parentEndpoint.GetPosition(), pParentPfoInfo->GetCluster3D(), pPfoInfo->GetCluster3D()) )
+                    this->IsCloseToParentEndpoint(pAlgorithm, parentEndpoint.GetPosition(), pParentPfoInfo, pPfoInfo, closestPositionsMap) )
                 {
                     associationsMade = true;
                     pParentPfoInfo->AddDaughterPfo(pPfoInfo->GetThisPfo());
@@ -97,24 +99,42 @@ void EndAssociatedPfosTool::Run(NeutrinoHierarchyAlgorithm *const pAlgorithm, co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool EndAssociatedPfosTool::IsCloseToParentEndpoint(const CartesianVector &parentEndpoint, const Cluster *const pParentCluster3D,
-    const Cluster *const pDaughterCluster3D) const
+bool EndAssociatedPfosTool::IsCloseToParentEndpoint(const NeutrinoHierarchyAlgorithm *const pAlgorithm, const CartesianVector &parentEndpoint,
+    const PfoInfo *const pParentPfoInfo, const PfoInfo *const pDaughterPfoInfo, ClosestPositionsMap &closestPositionsMap) const
 {
-    try
+    const PfoPair pfoPair(pParentPfoInfo->GetThisPfo(), pDaughterPfoInfo->GetThisPfo());
+    ClosestPositionsMap::const_iterator iter(closestPositionsMap.find(pfoPair));
+
+    if (closestPositionsMap.end() == iter)
     {
         CartesianVector parentPosition3D(0.f, 0.f, 0.f), daughterPosition3D(0.f, 0.f, 0.f);
-        LArClusterHelper::GetClosestPositions(pParentCluster3D, pDaughterCluster3D, parentPosition3D, daughterPosition3D);
+        const bool isFound(pAlgorithm->GetClosestPositions(pParentPfoInfo->GetCluster3D(), pDaughterPfoInfo->GetCluster3D(),
+            m_maxParentEndpointDistance, parentPosition3D, daughterPosition3D));
 
-        if (((parentPosition3D - parentEndpoint).GetMagnitude() < m_maxParentEndpointDistance) && ((parentPosition3D - daughterPosition3D).GetMagnitude() < m_maxParentEndpointDistance))
-            return true;
-    }
-    catch (const StatusCodeException &)
-    {
+        iter = closestPositionsMap.insert(ClosestPositionsMap::value_type(pfoPair, ClosestPositions(isFound, parentPosition3D, daughterPosition3D))).first;
     }
 
-    return false;
+    const ClosestPositions &closestPositions(iter->second);
+
+    if (!closestPositions.m_isFound)
+        return false;
+
+    return (((closestPositions.m_parentPosition - parentEndpoint).GetMagnitude() < m_maxParentEndpointDistance) &&
+        ((closestPositions.m_parentPosition - closestPositions.m_daughterPosition).GetMagnitude() < m_maxParentEndpointDistance));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EndAssociatedPfosTool::ClosestPositions::ClosestPositions(const bool isFound, const CartesianVector &parentPosition,
+        const CartesianVector &daughterPosition) :
+    m_isFound(isFound),
+    m_parentPosition(parentPosition),
+    m_daughterPosition(daughterPosition)
+{
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode EndAssociatedPfosTool::ReadSettings(const TiXmlHandle xmlHandle)
@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArThreeDReco/LArEventBuilding/NeutrinoHierarchyAlgorithm.h"
 
+#include <map>
+
 namespace lar_content
 {
 
@@ -29,17 +31,43 @@ public:
     void Run(NeutrinoHierarchyAlgorithm *const pAlgorithm, const pandora::Vertex *const pNeutrinoVertex, NeutrinoHierarchyAlgorithm::PfoInfoMap &pfoInfoMap);
 
 private:
+    /**
+     *  @brief  ClosestPositions class, the closest positions between a parent and a daughter 3D cluster
+     */
+    class ClosestPositions
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  isFound whether the closest positions were found
+         *  @param  parentPosition the closest position in the parent 3D cluster
+         *  @param  daughterPosition the closest position in the daughter 3D cluster
+         */
+        ClosestPositions(const bool isFound, const pandora::CartesianVector &parentPosition, const pandora::CartesianVector &daughterPosition);
+
+        bool                        m_isFound;              ///< Whether the closest positions were found
+        pandora::CartesianVector    m_parentPosition;       ///< The closest position in the parent 3D cluster
+        pandora::CartesianVector    m_daughterPosition;     ///< The closest position in the daughter 3D cluster
+    };
+
+    typedef std::pair<const pandora::ParticleFlowObject*, const pandora::ParticleFlowObject*> PfoPair;
+    typedef std::map<PfoPair, ClosestPositions> ClosestPositionsMap;
+
     /**
      *  @brief  Whether a daughter 3D cluster is in close proximity to the endpoint of a parent 3D cluster
      *
+     *  @param  pAlgorithm address of the calling algorithm, providing the hit index
      *  @param  parentEndpoint the parent endpoint position
-     *  @param  pParentCluster3D the address of the parent 3D cluster
-     *  @param  pDaughterCluster3D the address of the daughter 3D cluster
+     *  @param  pParentPfoInfo the address of the parent pfo info
+     *  @param  pDaughterPfoInfo the address of the daughter pfo info
+     *  @param  closestPositionsMap the closest positions for the pfo pairs considered so far, to be extended with the current pair
      *
      *  @return boolean
      */
-    bool IsCloseToParentEndpoint(const pandora::CartesianVector &parentEndpoint, const pandora::Cluster *const pParentCluster3D,
-        const pandora::Cluster *const pDaughterCluster3D) const;
+    bool IsCloseToParentEndpoint(const NeutrinoHierarchyAlgorithm *const pAlgorithm, const pandora::CartesianVector &parentEndpoint,
+        const NeutrinoHierarchyAlgorithm::PfoInfo *const pParentPfoInfo, const NeutrinoHierarchyAlgorithm::PfoInfo *const pDaughterPfoInfo,
+        ClosestPositionsMap &closestPositionsMap) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -53,7 +53,8 @@ EventSlicingTool::EventSlicingTool() :
     m_coneBoundedFraction1(0.5f),
     m_coneTanHalfAngle2(0.75f),
     m_coneBoundedFraction2(0.75f),
-    m_use3DProjectionsInHitPickUp(true)
+    m_use3DProjectionsInHitPickUp(true),
+    m_useSpatialIndex(false)
 {
 }
 
@@ -189,10 +190,17 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
     sortedClusters3D.insert(sortedClusters3D.end(), showerClusters3D.begin(), showerClusters3D.end());
     std::sort(sortedClusters3D.begin(), sortedClusters3D.end(), LArClusterHelper::SortByNHits);
 
+    ClusterExtentVector clusterExtents;
+
+    if (m_useSpatialIndex)
+        this->GetClusterExtents(sortedClusters3D, trackFitResults, showerConeFitResults, clusterExtents);
+
     ClusterSet usedClusters;
 
-    for (const Cluster *const pCluster3D : sortedClusters3D)
+    for (unsigned int clusterIndex = 0; clusterIndex < sortedClusters3D.size(); ++clusterIndex)
     {
+        const Cluster *const pCluster3D(sortedClusters3D.at(clusterIndex));
+
         if (usedClusters.count(pCluster3D))
             continue;
 
@@ -203,8 +211,243 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
         usedClusters.insert(pCluster3D);
 
         ClusterVector &clusterSlice(clusterSliceList.back());
-        this->CollectAssociatedClusters(pCluster3D, sortedClusters3D, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+
+        if (m_useSpatialIndex)
+        {
+            this->CollectAssociatedClusters(clusterIndex, sortedClusters3D, clusterExtents, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+        }
+        else
+        {
+            this->CollectAssociatedClusters(pCluster3D, sortedClusters3D, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSlicingTool::GetClusterExtents(const ClusterVector &candidateClusters, const ThreeDSlidingFitResultMap &trackFitResults,
+    const ThreeDSlidingConeFitResultMap &showerConeFitResults, ClusterExtentVector &clusterExtents) const
+{
+    // ATTN Shower cones can only bound hits within reach of their apex, unless the required bounded fractions are trivially satisfied
+    const bool isConeReachBounded((m_coneBoundedFraction1 > 0.f) || (m_coneBoundedFraction2 > 0.f));
+    const float coneTanHalfAngle(((m_coneBoundedFraction1 > 0.f) && (m_coneBoundedFraction2 > 0.f)) ? std::min(m_coneTanHalfAngle1, m_coneTanHalfAngle2) :
+        (m_coneBoundedFraction1 > 0.f) ? m_coneTanHalfAngle1 : m_coneTanHalfAngle2);
+
+    for (const Cluster *const pCluster3D : candidateClusters)
+    {
+        clusterExtents.push_back(ClusterExtent());
+        ClusterExtent &clusterExtent(clusterExtents.back());
+
+        CartesianPointVector hitPositions;
+        LArClusterHelper::GetCoordinateVector(pCluster3D, hitPositions);
+
+        float minX(std::numeric_limits<float>::max()), minY(std::numeric_limits<float>::max()), minZ(std::numeric_limits<float>::max());
+        float maxX(-std::numeric_limits<float>::max()), maxY(-std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+        for (const CartesianVector &hitPosition : hitPositions)
+        {
+            minX = std::min(minX, hitPosition.GetX()); maxX = std::max(maxX, hitPosition.GetX());
+            minY = std::min(minY, hitPosition.GetY()); maxY = std::max(maxY, hitPosition.GetY());
+            minZ = std::min(minZ, hitPosition.GetZ()); maxZ = std::max(maxZ, hitPosition.GetZ());
+        }
+
+        clusterExtent.m_minHitPosition = CartesianVector(minX, minY, minZ);
+        clusterExtent.m_maxHitPosition = CartesianVector(maxX, maxY, maxZ);
+
+        ThreeDSlidingFitResultMap::const_iterator fitIter(trackFitResults.find(pCluster3D));
+
+        if (m_usePointingAssociation && (trackFitResults.end() != fitIter))
+        {
+            const LArPointingCluster pointingCluster(fitIter->second);
+            clusterExtent.m_vertexPositions.push_back(pointingCluster.GetInnerVertex().GetPosition());
+            clusterExtent.m_vertexPositions.push_back(pointingCluster.GetOuterVertex().GetPosition());
+        }
+
+        ThreeDSlidingConeFitResultMap::const_iterator coneFitIter(showerConeFitResults.find(pCluster3D));
+
+        if (!m_useShowerConeAssociation || (showerConeFitResults.end() == coneFitIter))
+            continue;
+
+        float clusterLength(0.f);
+        SimpleConeList simpleConeList;
+
+        try
+        {
+            const ThreeDSlidingConeFitResult &slidingConeFitResult3D(coneFitIter->second);
+            const ThreeDSlidingFitResult &slidingFitResult3D(slidingConeFitResult3D.GetSlidingFitResult());
+            slidingConeFitResult3D.GetSimpleConeList(m_nConeFitLayers, m_nConeFits, CONE_BOTH_DIRECTIONS, simpleConeList);
+            clusterLength = (slidingFitResult3D.GetGlobalMaxLayerPosition() - slidingFitResult3D.GetGlobalMinLayerPosition()).GetMagnitude();
+        }
+        catch (const StatusCodeException &)
+        {
+            continue;
+        }
+
+        if (simpleConeList.empty())
+            continue;
+
+        const float coneLength(std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength));
+        const float coneReach(isConeReachBounded ? 1.01f * std::fabs(coneLength) * std::sqrt(1.f + coneTanHalfAngle * coneTanHalfAngle) + 1.f :
+            std::numeric_limits<float>::max());
+
+        float minConeX(std::numeric_limits<float>::max()), minConeY(std::numeric_limits<float>::max()), minConeZ(std::numeric_limits<float>::max());
+        float maxConeX(-std::numeric_limits<float>::max()), maxConeY(-std::numeric_limits<float>::max()), maxConeZ(-std::numeric_limits<float>::max());
+
+        for (const SimpleCone &simpleCone : simpleConeList)
+        {
+            const CartesianVector &coneApex(simpleCone.GetConeApex());
+            minConeX = std::min(minConeX, coneApex.GetX() - coneReach); maxConeX = std::max(maxConeX, coneApex.GetX() + coneReach);
+            minConeY = std::min(minConeY, coneApex.GetY() - coneReach); maxConeY = std::max(maxConeY, coneApex.GetY() + coneReach);
+            minConeZ = std::min(minConeZ, coneApex.GetZ() - coneReach); maxConeZ = std::max(maxConeZ, coneApex.GetZ() + coneReach);
+        }
+
+        clusterExtent.m_hasConeExtent = true;
+        clusterExtent.m_minConePosition = CartesianVector(minConeX, minConeY, minConeZ);
+        clusterExtent.m_maxConePosition = CartesianVector(maxConeX, maxConeY, maxConeZ);
+    }
+
+    if (m_useProximityAssociation)
+        this->FillProximityAssociations(candidateClusters, clusterExtents);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSlicingTool::FillProximityAssociations(const ClusterVector &candidateClusters, ClusterExtentVector &clusterExtents) const
+{
+    // ATTN Hits closer than the cell size lie in the same or adjacent cells; the margin absorbs rounding in the cell calculation
+    const float cellSize(std::max(1.f, 1.01f * std::sqrt(m_maxHitSeparationSquared) + 0.1f));
+    HitGridMap hitGridMap;
+
+    for (unsigned int clusterIndex = 0; clusterIndex < candidateClusters.size(); ++clusterIndex)
+    {
+        for (const auto &orderedList : candidateClusters.at(clusterIndex)->GetOrderedCaloHitList())
+        {
+            for (const CaloHit *const pCaloHit : *(orderedList.second))
+                hitGridMap[this->GetGridCell(pCaloHit->GetPositionVector(), cellSize)].push_back(std::make_pair(clusterIndex, pCaloHit));
+        }
+    }
+
+    for (const HitGridMap::value_type &gridEntry : hitGridMap)
+    {
+        const GridCell &gridCell(gridEntry.first);
+
+        for (int iX = std::get<0>(gridCell) - 1; iX <= std::get<0>(gridCell) + 1; ++iX)
+        {
+            for (int iY = std::get<1>(gridCell) - 1; iY <= std::get<1>(gridCell) + 1; ++iY)
+            {
+                for (int iZ = std::get<2>(gridCell) - 1; iZ <= std::get<2>(gridCell) + 1; ++iZ)
+                {
+                    HitGridMap::const_iterator nearbyIter(hitGridMap.find(GridCell(iX, iY, iZ)));
+
+                    if (hitGridMap.end() == nearbyIter)
+                        continue;
+
+                    for (const auto &hitEntry1 : gridEntry.second)
+                    {
+                        std::set<unsigned int> &proximityIndices(clusterExtents.at(hitEntry1.first).m_proximityIndices);
+                        const CartesianVector &positionVector1(hitEntry1.second->GetPositionVector());
+
+                        for (const auto &hitEntry2 : nearbyIter->second)
+                        {
+                            if ((hitEntry1.first == hitEntry2.first) || proximityIndices.count(hitEntry2.first))
+                                continue;
+
+                            if ((positionVector1 - hitEntry2.second->GetPositionVector()).GetMagnitudeSquared() < m_maxHitSeparationSquared)
+                            {
+                                proximityIndices.insert(hitEntry2.first);
+                                clusterExtents.at(hitEntry2.first).m_proximityIndices.insert(hitEntry1.first);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSlicingTool::CollectAssociatedClusters(const unsigned int clusterIndex, const ClusterVector &candidateClusters,
+    const ClusterExtentVector &clusterExtents, const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
+    ClusterVector &clusterSlice, ClusterSet &usedClusters) const
+{
+    // ATTN Mirrors the exhaustive method, with the candidates visited in the same order, so the slices are unchanged
+    const Cluster *const pClusterInSlice(candidateClusters.at(clusterIndex));
+    const ClusterExtent &inSliceExtent(clusterExtents.at(clusterIndex));
+    std::vector<unsigned int> addedIndices;
+
+    for (unsigned int candidateIndex = 0; candidateIndex < candidateClusters.size(); ++candidateIndex)
+    {
+        const Cluster *const pCandidateCluster(candidateClusters.at(candidateIndex));
+
+        if (usedClusters.count(pCandidateCluster) || (pClusterInSlice == pCandidateCluster))
+            continue;
+
+        const ClusterExtent &candidateExtent(clusterExtents.at(candidateIndex));
+
+        if ((m_usePointingAssociation && this->CanPassPointing(inSliceExtent, candidateExtent) && this->PassPointing(pClusterInSlice, pCandidateCluster, trackFitResults)) ||
+            (m_useProximityAssociation && inSliceExtent.m_proximityIndices.count(candidateIndex)) ||
+            (m_useShowerConeAssociation && ((this->CanPassShowerCone(inSliceExtent, candidateExtent) && this->PassShowerCone(pClusterInSlice, pCandidateCluster, showerConeFitResults)) ||
+                (this->CanPassShowerCone(candidateExtent, inSliceExtent) && this->PassShowerCone(pCandidateCluster, pClusterInSlice, showerConeFitResults)))) )
+        {
+            addedIndices.push_back(candidateIndex);
+            (void) usedClusters.insert(pCandidateCluster);
+        }
     }
+
+    for (const unsigned int addedIndex : addedIndices)
+        clusterSlice.push_back(candidateClusters.at(addedIndex));
+
+    for (const unsigned int addedIndex : addedIndices)
+        this->CollectAssociatedClusters(addedIndex, candidateClusters, clusterExtents, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventSlicingTool::CanPassPointing(const ClusterExtent &extent1, const ClusterExtent &extent2) const
+{
+    if (extent1.m_vertexPositions.empty() || extent2.m_vertexPositions.empty())
+        return false;
+
+    // The closest approach, node and emission cuts each bound the separation of the relevant pair of vertices
+    const float tanSqTheta(std::pow(std::tan(M_PI * m_vertexAngularAllowance / 180.f), 2.0));
+    const float maxLongitudinalDistance(std::max(std::fabs(m_minVertexLongitudinalDistance), m_maxVertexLongitudinalDistance));
+    const float maxTransverseDistanceSquared(m_maxVertexTransverseDistance * m_maxVertexTransverseDistance);
+    const float maxEmissionSeparation(std::sqrt(maxLongitudinalDistance * maxLongitudinalDistance * (1.f + tanSqTheta) + maxTransverseDistanceSquared));
+    const float maxNodeSeparation(std::sqrt(m_minVertexLongitudinalDistance * m_minVertexLongitudinalDistance + maxTransverseDistanceSquared));
+    const float maxApproachSeparation(std::fabs(m_maxClosestApproach) + 2.f * std::fabs(m_maxInterceptDistance));
+    const float maxSeparation(1.01f * std::max(maxApproachSeparation, std::max(maxEmissionSeparation, maxNodeSeparation)) + 1.f);
+
+    for (const CartesianVector &vertexPosition1 : extent1.m_vertexPositions)
+    {
+        for (const CartesianVector &vertexPosition2 : extent2.m_vertexPositions)
+        {
+            if ((vertexPosition1 - vertexPosition2).GetMagnitudeSquared() < maxSeparation * maxSeparation)
+                return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventSlicingTool::CanPassShowerCone(const ClusterExtent &coneExtent, const ClusterExtent &nearbyExtent) const
+{
+    if (!coneExtent.m_hasConeExtent)
+        return false;
+
+    return ((coneExtent.m_minConePosition.GetX() <= nearbyExtent.m_maxHitPosition.GetX()) && (nearbyExtent.m_minHitPosition.GetX() <= coneExtent.m_maxConePosition.GetX()) &&
+        (coneExtent.m_minConePosition.GetY() <= nearbyExtent.m_maxHitPosition.GetY()) && (nearbyExtent.m_minHitPosition.GetY() <= coneExtent.m_maxConePosition.GetY()) &&
+        (coneExtent.m_minConePosition.GetZ() <= nearbyExtent.m_maxHitPosition.GetZ()) && (nearbyExtent.m_minHitPosition.GetZ() <= coneExtent.m_maxConePosition.GetZ()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventSlicingTool::GridCell EventSlicingTool::GetGridCell(const CartesianVector &position, const float cellSize) const
+{
+    return GridCell(static_cast<int>(std::floor(position.GetX() / cellSize)), static_cast<int>(std::floor(position.GetY() / cellSize)),
+        static_cast<int>(std::floor(position.GetZ() / cellSize)));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -675,6 +918,18 @@ bool EventSlicingTool::SortPoints(const CartesianVector *const pLhs, const Carte
     return (deltaPosition.GetY() > std::numeric_limits<float>::epsilon());
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventSlicingTool::ClusterExtent::ClusterExtent() :
+    m_minHitPosition(0.f, 0.f, 0.f),
+    m_maxHitPosition(0.f, 0.f, 0.f),
+    m_hasConeExtent(false),
+    m_minConePosition(0.f, 0.f, 0.f),
+    m_maxConePosition(0.f, 0.f, 0.f)
+{
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode EventSlicingTool::ReadSettings(const TiXmlHandle xmlHandle)
@@ -753,6 +1008,9 @@ StatusCode EventSlicingTool::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "Use3DProjectionsInHitPickUp", m_use3DProjectionsInHitPickUp));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "UseSpatialIndex", m_useSpatialIndex));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -12,6 +12,9 @@
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingConeFitResult.h"
 
+#include <map>
+#include <set>
+#include <tuple>
 #include <unordered_map>
 
 namespace lar_content
@@ -75,6 +78,94 @@ private:
     void GetClusterSliceList(const pandora::ClusterList &trackClusters3D, const pandora::ClusterList &showerClusters3D,
         ClusterSliceList &clusterSliceList) const;
 
+    /**
+     *  @brief  ClusterExtent class, bounding information used to restrict the cluster pairs tested for association
+     */
+    class ClusterExtent
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        ClusterExtent();
+
+        pandora::CartesianVector        m_minHitPosition;       ///< The minimum hit coordinates of the cluster
+        pandora::CartesianVector        m_maxHitPosition;       ///< The maximum hit coordinates of the cluster
+        pandora::CartesianPointVector   m_vertexPositions;      ///< The pointing cluster vertex positions, for track clusters
+        bool                            m_hasConeExtent;        ///< Whether the cluster has shower cones that could bound other clusters
+        pandora::CartesianVector        m_minConePosition;      ///< The minimum coordinates reachable by the shower cones
+        pandora::CartesianVector        m_maxConePosition;      ///< The maximum coordinates reachable by the shower cones
+        std::set<unsigned int>          m_proximityIndices;     ///< The indices of clusters with a hit within the proximity association distance
+    };
+
+    typedef std::vector<ClusterExtent> ClusterExtentVector;
+    typedef std::tuple<int, int, int> GridCell;
+    typedef std::map<GridCell, std::vector<std::pair<unsigned int, const pandora::CaloHit*>>> HitGridMap;
+
+    /**
+     *  @brief  Calculate the extent of each candidate cluster, and find proximity associations using a spatial grid of all 3D hits
+     *
+     *  @param  candidateClusters the candidate clusters
+     *  @param  trackFitResults the map of sliding fit results for track candidate clusters
+     *  @param  showerConeFitResults the map of sliding cone fit results for shower candidate clusters
+     *  @param  clusterExtents to receive the extent of each candidate cluster
+     */
+    void GetClusterExtents(const pandora::ClusterVector &candidateClusters, const ThreeDSlidingFitResultMap &trackFitResults,
+        const ThreeDSlidingConeFitResultMap &showerConeFitResults, ClusterExtentVector &clusterExtents) const;
+
+    /**
+     *  @brief  Find all pairs of clusters with a pair of hits within the proximity association distance
+     *
+     *  @param  candidateClusters the candidate clusters
+     *  @param  clusterExtents the cluster extents, to receive the proximity associations
+     */
+    void FillProximityAssociations(const pandora::ClusterVector &candidateClusters, ClusterExtentVector &clusterExtents) const;
+
+    /**
+     *  @brief  Collect all clusters associated with a provided cluster, only testing cluster pairs with compatible extents
+     *
+     *  @param  clusterIndex the index of the cluster already in a slice
+     *  @param  candidateClusters the list of candidate clusters
+     *  @param  clusterExtents the extent of each candidate cluster
+     *  @param  trackFitResults the map of sliding fit results for track candidate clusters
+     *  @param  showerConeFitResults the map of sliding const fit results for shower candidate clusters
+     *  @param  clusterSlice the cluster slice
+     *  @param  usedClusters the list of clusters already added to slices
+     */
+    void CollectAssociatedClusters(const unsigned int clusterIndex, const pandora::ClusterVector &candidateClusters, const ClusterExtentVector &clusterExtents,
+        const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults, pandora::ClusterVector &clusterSlice,
+        pandora::ClusterSet &usedClusters) const;
+
+    /**
+     *  @brief  Whether the pointing cluster vertices of a pair of clusters are close enough to pass the pointing association
+     *
+     *  @param  extent1 the extent of the first cluster
+     *  @param  extent2 the extent of the second cluster
+     *
+     *  @return boolean
+     */
+    bool CanPassPointing(const ClusterExtent &extent1, const ClusterExtent &extent2) const;
+
+    /**
+     *  @brief  Whether the shower cones of a cluster could bound the hits of a nearby cluster
+     *
+     *  @param  coneExtent the extent of the cluster providing the shower cones
+     *  @param  nearbyExtent the extent of the nearby cluster
+     *
+     *  @return boolean
+     */
+    bool CanPassShowerCone(const ClusterExtent &coneExtent, const ClusterExtent &nearbyExtent) const;
+
+    /**
+     *  @brief  Get the cell of the hit grid containing a given position
+     *
+     *  @param  position the position
+     *  @param  cellSize the grid cell size
+     *
+     *  @return the grid cell
+     */
+    GridCell GetGridCell(const pandora::CartesianVector &position, const float cellSize) const;
+
     /**
      *  @brief  Collect all clusters associated with a provided cluster
      *
@@ -295,6 +386,8 @@ private:
     float           m_coneBoundedFraction2;             ///< The minimum cluster bounded fraction for association 2
 
     bool            m_use3DProjectionsInHitPickUp;      ///< Whether to include 3D cluster projections when assigning remaining clusters to slices
+
+    bool            m_useSpatialIndex;                  ///< Whether to restrict the cluster pairs tested for association using their spatial extents
 };
 
 } // namespace lar_content
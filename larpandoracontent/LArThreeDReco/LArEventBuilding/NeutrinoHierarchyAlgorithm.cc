@@ -10,9 +10,14 @@
 
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArEventBuilding/NeutrinoHierarchyAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <limits>
+
 using namespace pandora;
 
 namespace lar_content
@@ -20,12 +25,20 @@ namespace lar_content
 
 NeutrinoHierarchyAlgorithm::NeutrinoHierarchyAlgorithm() :
     m_halfWindowLayers(20),
-    m_displayPfoInfoMap(false)
+    m_displayPfoInfoMap(false),
+    m_pHitKDTree(nullptr)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+NeutrinoHierarchyAlgorithm::~NeutrinoHierarchyAlgorithm()
+{
+    this->ClearHitIndex();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void NeutrinoHierarchyAlgorithm::SeparatePfos(const PfoInfoMap &pfoInfoMap, PfoVector &assignedPfos, PfoVector &unassignedPfos) const
 {
     PfoVector sortedPfos;
@@ -49,6 +62,71 @@ void NeutrinoHierarchyAlgorithm::SeparatePfos(const PfoInfoMap &pfoInfoMap, PfoV
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float NeutrinoHierarchyAlgorithm::GetClosestDistance(const CartesianVector &position, const Cluster *const pCluster3D, const float searchDistance) const
+{
+    CaloHitVector caloHitVector;
+    this->SearchHitIndex(position, pCluster3D, searchDistance, caloHitVector);
+
+    const CaloHit *pClosestCaloHit(nullptr);
+    float closestDistanceSquared(std::numeric_limits<float>::max());
+
+    for (const CaloHit *const pCaloHit : caloHitVector)
+    {
+        const float distanceSquared((pCaloHit->GetPositionVector() - position).GetMagnitudeSquared());
+
+        if (distanceSquared < closestDistanceSquared)
+        {
+            closestDistanceSquared = distanceSquared;
+            pClosestCaloHit = pCaloHit;
+        }
+    }
+
+    if (!pClosestCaloHit)
+        return std::numeric_limits<float>::max();
+
+    return (position - pClosestCaloHit->GetPositionVector()).GetMagnitude();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool NeutrinoHierarchyAlgorithm::GetClosestPositions(const Cluster *const pCluster1, const Cluster *const pCluster2, const float searchDistance,
+    CartesianVector &outputPosition1, CartesianVector &outputPosition2) const
+{
+    bool distanceFound(false);
+    float minDistanceSquared(std::numeric_limits<float>::max());
+
+    const OrderedCaloHitList &orderedCaloHitList1(pCluster1->GetOrderedCaloHitList());
+
+    for (OrderedCaloHitList::const_iterator iter1 = orderedCaloHitList1.begin(), iter1End = orderedCaloHitList1.end(); iter1 != iter1End; ++iter1)
+    {
+        for (const CaloHit *const pCaloHit1 : *(iter1->second))
+        {
+            const CartesianVector &positionVector1(pCaloHit1->GetPositionVector());
+
+            CaloHitVector caloHitVector2;
+            this->SearchHitIndex(positionVector1, pCluster2, searchDistance, caloHitVector2);
+
+            for (const CaloHit *const pCaloHit2 : caloHitVector2)
+            {
+                const CartesianVector &positionVector2(pCaloHit2->GetPositionVector());
+                const float distanceSquared((positionVector1 - positionVector2).GetMagnitudeSquared());
+
+                if (distanceSquared < minDistanceSquared)
+                {
+                    minDistanceSquared = distanceSquared;
+                    outputPosition1 = positionVector1;
+                    outputPosition2 = positionVector2;
+                    distanceFound = true;
+                }
+            }
+        }
+    }
+
+    return distanceFound;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode NeutrinoHierarchyAlgorithm::Run()
 {
     const ParticleFlowObject *pNeutrinoPfo(nullptr);
@@ -72,31 +150,54 @@ StatusCode NeutrinoHierarchyAlgorithm::Run()
 
     PfoInfoMap pfoInfoMap;
 
+    // ATTN The hit index and pfo infos are cleared on every exit path, including when an unexpected exception is rethrown
     try
     {
-        if (!pNeutrinoPfo->GetVertexList().empty())
+        try
         {
-            const Vertex *const pNeutrinoVertex(LArPfoHelper::GetVertex(pNeutrinoPfo));
-            this->GetInitialPfoInfoMap(candidateDaughterPfoList, pfoInfoMap);
-
-            for (PfoRelationTool *const pPfoRelationTool : m_algorithmToolVector)
-                pPfoRelationTool->Run(this, pNeutrinoVertex, pfoInfoMap);
+            if (!pNeutrinoPfo->GetVertexList().empty())
+            {
+                const Vertex *const pNeutrinoVertex(LArPfoHelper::GetVertex(pNeutrinoPfo));
+                this->GetInitialPfoInfoMap(candidateDaughterPfoList, pfoInfoMap);
+                this->BuildHitIndex(pfoInfoMap);
+
+                for (PfoRelationTool *const pPfoRelationTool : m_algorithmToolVector)
+                {
+                    const LArProfilingHelper::ScopedTimer scopedTimer(pPfoRelationTool);
+                    pPfoRelationTool->Run(this, pNeutrinoVertex, pfoInfoMap);
+                }
+            }
+
+            this->ProcessPfoInfoMap(pNeutrinoPfo, candidateDaughterPfoList, pfoInfoMap);
+        }
+        catch (StatusCodeException &statusCodeException)
+        {
+            std::cout << "NeutrinoHierarchyAlgorithm: unable to process input neutrino pfo, " << statusCodeException.ToString() << std::endl;
         }
 
-        this->ProcessPfoInfoMap(pNeutrinoPfo, candidateDaughterPfoList, pfoInfoMap);
+        if (m_displayPfoInfoMap)
+            this->DisplayPfoInfoMap(pNeutrinoPfo, pfoInfoMap);
     }
-    catch (StatusCodeException &statusCodeException)
+    catch (...)
     {
-        std::cout << "NeutrinoHierarchyAlgorithm: unable to process input neutrino pfo, " << statusCodeException.ToString() << std::endl;
+        this->ClearEventState(pfoInfoMap);
+        throw;
     }
 
-    if (m_displayPfoInfoMap)
-        this->DisplayPfoInfoMap(pNeutrinoPfo, pfoInfoMap);
+    this->ClearEventState(pfoInfoMap);
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void NeutrinoHierarchyAlgorithm::ClearEventState(PfoInfoMap &pfoInfoMap)
+{
+    this->ClearHitIndex();
 
     for (auto &mapIter : pfoInfoMap)
         delete mapIter.second;
 
-    return STATUS_CODE_SUCCESS;
+    pfoInfoMap.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -170,6 +271,97 @@ void NeutrinoHierarchyAlgorithm::GetInitialPfoInfoMap(const PfoList &pfoList, Pf
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void NeutrinoHierarchyAlgorithm::BuildHitIndex(const PfoInfoMap &pfoInfoMap)
+{
+    this->ClearHitIndex();
+
+    CaloHitList allCaloHits;
+    CaloHitSet allCaloHitSet;
+
+    for (const auto &mapEntry : pfoInfoMap)
+    {
+        const Cluster *const pCluster3D(mapEntry.second->GetCluster3D());
+
+        if (m_clusterToHitIndexMap.count(pCluster3D))
+            continue;
+
+        HitToIndexMap &hitToIndexMap(m_clusterToHitIndexMap[pCluster3D]);
+        const OrderedCaloHitList &orderedCaloHitList(pCluster3D->GetOrderedCaloHitList());
+        unsigned int hitIndex(0);
+
+        for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+        {
+            for (const CaloHit *const pCaloHit : *(iter->second))
+            {
+                (void) hitToIndexMap.insert(HitToIndexMap::value_type(pCaloHit, hitIndex++));
+
+                // ATTN Hits shared between clusters enter the kd tree once, and are matched to each cluster via its own hit index map
+                if (allCaloHitSet.insert(pCaloHit).second)
+                    allCaloHits.push_back(pCaloHit);
+            }
+        }
+    }
+
+    if (allCaloHits.empty())
+        return;
+
+    HitKDNode3DList hitKDNode3DList;
+    KDTreeCube hitsBoundingRegion3D(fill_and_bound_3d_kd_tree(allCaloHits, hitKDNode3DList));
+
+    m_pHitKDTree = new HitKDTree3D;
+    m_pHitKDTree->build(hitKDNode3DList, hitsBoundingRegion3D);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void NeutrinoHierarchyAlgorithm::ClearHitIndex()
+{
+    delete m_pHitKDTree;
+    m_pHitKDTree = nullptr;
+
+    m_clusterToHitIndexMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void NeutrinoHierarchyAlgorithm::SearchHitIndex(const CartesianVector &position, const Cluster *const pCluster3D, const float searchDistance,
+    CaloHitVector &caloHitVector) const
+{
+    if (!m_pHitKDTree)
+        return;
+
+    ClusterToHitIndexMap::const_iterator clusterIter(m_clusterToHitIndexMap.find(pCluster3D));
+
+    if (m_clusterToHitIndexMap.end() == clusterIter)
+        return;
+
+    const HitToIndexMap &hitToIndexMap(clusterIter->second);
+
+    // ATTN Pad the search cube, so that hits at the search distance cannot be lost to rounding of the cube edges
+    const float searchRegion1D(1.01f * searchDistance + 0.1f);
+
+    HitKDNode3DList found;
+    m_pHitKDTree->search(build_3d_kd_search_region(position, searchRegion1D, searchRegion1D, searchRegion1D), found);
+
+    std::vector<std::pair<unsigned int, const CaloHit*>> indexedCaloHits;
+
+    for (const HitKDNode3D &hit : found)
+    {
+        HitToIndexMap::const_iterator hitIter(hitToIndexMap.find(hit.data));
+
+        if (hitToIndexMap.end() != hitIter)
+            indexedCaloHits.push_back(std::make_pair(hitIter->second, hit.data));
+    }
+
+    // ATTN Visit hits in cluster order, so that ties are resolved exactly as when looping over the full cluster
+    std::sort(indexedCaloHits.begin(), indexedCaloHits.end());
+
+    for (const auto &indexedCaloHit : indexedCaloHits)
+        caloHitVector.push_back(indexedCaloHit.second);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void NeutrinoHierarchyAlgorithm::ProcessPfoInfoMap(const ParticleFlowObject *const pNeutrinoPfo, const PfoList &candidateDaughterPfoList,
     const PfoInfoMap &pfoInfoMap) const
 {
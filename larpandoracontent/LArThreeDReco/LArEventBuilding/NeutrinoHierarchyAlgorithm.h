@@ -19,6 +19,9 @@ namespace lar_content
 
 class PfoRelationTool;
 
+template<typename, unsigned int> class KDTreeLinkerAlgo;
+template<typename, unsigned int> class KDTreeNodeInfoT;
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -32,6 +35,11 @@ public:
      */
     NeutrinoHierarchyAlgorithm();
 
+    /**
+     *  @brief  Destructor
+     */
+    ~NeutrinoHierarchyAlgorithm();
+
     /**
      *  @brief  PfoInfo class
      */
@@ -178,9 +186,74 @@ public:
      */
     void SeparatePfos(const NeutrinoHierarchyAlgorithm::PfoInfoMap &pfoInfoMap, pandora::PfoVector &assignedPfos, pandora::PfoVector &unassignedPfos) const;
 
+    /**
+     *  @brief  Get the closest distance between a position and the hits in a three dimensional pfo cluster, using the hit index for
+     *          the current event. The result is identical to LArClusterHelper::GetClosestDistance if within the search distance.
+     * 
+     *  @param  position the position
+     *  @param  pCluster3D the address of the three dimensional cluster
+     *  @param  searchDistance the search distance
+     * 
+     *  @return the closest distance, or a distance no smaller than the true closest distance if beyond the search distance
+     */
+    float GetClosestDistance(const pandora::CartesianVector &position, const pandora::Cluster *const pCluster3D, const float searchDistance) const;
+
+    /**
+     *  @brief  Get the closest positions between the hits in two three dimensional pfo clusters, using the hit index for the current
+     *          event. The result is identical to LArClusterHelper::GetClosestPositions if within the search distance.
+     * 
+     *  @param  pCluster1 the address of the first three dimensional cluster
+     *  @param  pCluster2 the address of the second three dimensional cluster
+     *  @param  searchDistance the search distance
+     *  @param  outputPosition1 to receive the closest position in the first cluster
+     *  @param  outputPosition2 to receive the closest position in the second cluster
+     * 
+     *  @return whether any pair of hits was found, with positions no closer than the true closest positions if beyond the search distance
+     */
+    bool GetClosestPositions(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const float searchDistance,
+        pandora::CartesianVector &outputPosition1, pandora::CartesianVector &outputPosition2) const;
+
 private:
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit*, 3> HitKDTree3D;
+    typedef KDTreeNodeInfoT<const pandora::CaloHit*, 3> HitKDNode3D;
+    typedef std::vector<HitKDNode3D> HitKDNode3DList;
+
+    typedef std::unordered_map<const pandora::CaloHit*, unsigned int> HitToIndexMap;
+    typedef std::unordered_map<const pandora::Cluster*, HitToIndexMap> ClusterToHitIndexMap;
+
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Build the hit index for the current event, containing the hits in the three dimensional clusters in a pfo info map;
+     *          hits shared between clusters are indexed once, but remain associated with each of their clusters
+     * 
+     *  @param  pfoInfoMap the pfo info map
+     */
+    void BuildHitIndex(const PfoInfoMap &pfoInfoMap);
+
+    /**
+     *  @brief  Clear the hit index for the current event
+     */
+    void ClearHitIndex();
+
+    /**
+     *  @brief  Clear the hit index and delete the pfo infos for the current event
+     * 
+     *  @param  pfoInfoMap the pfo info map, to be emptied
+     */
+    void ClearEventState(PfoInfoMap &pfoInfoMap);
+
+    /**
+     *  @brief  Search the hit index for hits in a specified cluster, within a cube about a position
+     * 
+     *  @param  position the position
+     *  @param  pCluster3D the address of the three dimensional cluster
+     *  @param  searchDistance the search distance
+     *  @param  caloHitVector to receive the hits found, in the order of the cluster ordered calo hit list
+     */
+    void SearchHitIndex(const pandora::CartesianVector &position, const pandora::Cluster *const pCluster3D, const float searchDistance,
+        pandora::CaloHitVector &caloHitVector) const;
+
     /**
      *  @brief  Get the address of the input neutrino pfo - enforces only one pfo present in input list; can return NULL if no neutrino exists
      * 
@@ -231,6 +304,9 @@ private:
 
     unsigned int                    m_halfWindowLayers;         ///< The number of layers to use for half-window of sliding fit
     bool                            m_displayPfoInfoMap;        ///< Whether to display the pfo info map (if monitoring is enabled)
+
+    HitKDTree3D                    *m_pHitKDTree;               ///< The kd tree of hits in the pfo three dimensional clusters, for the current event
+    ClusterToHitIndexMap            m_clusterToHitIndexMap;     ///< The map from indexed clusters to the position of each hit in their ordered calo hit lists
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArLongitudinalTrackMatching/ThreeDLongitudinalTracksAlgorithm.h"
 
@@ -203,6 +204,8 @@ void ThreeDLongitudinalTracksAlgorithm::ExamineTensor()
 
     for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd; )
     {
+        const LArProfilingHelper::ScopedTimer scopedTimer(*iter);
+
         if ((*iter)->Run(this, m_overlapTensor))
         {
             iter = m_algorithmToolVector.begin();
@@ -126,6 +126,11 @@ void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVerte
     VertexAssociationMap vertexAssociationMap;
     const float layerPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
+    ClusterExtentMap clusterExtentMap;
+
+    for (const Cluster *const pCluster : clusters3D)
+        (void) clusterExtentMap.insert(ClusterExtentMap::value_type(pCluster, ClusterExtent(pCluster)));
+
     for (const Cluster *const pShowerCluster : clusters3D)
     {
         if ((pShowerCluster->GetNCaloHits() < m_minHitsToConsider3DShower) || !LArPfoHelper::IsShower(clusterToPfoMap.at(pShowerCluster)))
@@ -157,21 +162,26 @@ void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVerte
             if (pNearbyCluster == pShowerCluster)
                 continue;
 
+            if (isShowerVertexAssociated && this->IsVertexAssociated(pNearbyCluster, pVertex, vertexAssociationMap))
+                continue;
+
+            const ClusterExtent &nearbyClusterExtent(clusterExtentMap.at(pNearbyCluster));
             ClusterMerge bestClusterMerge(nullptr, 0.f, 0.f);
 
             for (const SimpleCone &simpleCone : simpleConeList)
             {
-                const float boundedFraction1(simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1));
-                const float boundedFraction2(simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2));
+                // ATTN Bounded fractions are exactly zero for clusters that cannot overlap the cone, so skip the hit loop for these
+                float boundedFraction1(0.f), boundedFraction2(0.f);
+
+                if (this->CouldBeBounded(simpleCone, coneLength, nearbyClusterExtent))
+                    simpleCone.GetBoundedHitFractions(nearbyClusterExtent.m_hitPositions, coneLength, m_coneTanHalfAngle1, m_coneTanHalfAngle2, boundedFraction1, boundedFraction2);
+
                 const ClusterMerge clusterMerge(pShowerCluster, boundedFraction1, boundedFraction2);
 
                 if (clusterMerge < bestClusterMerge)
                     bestClusterMerge = clusterMerge;
             }
 
-            if (isShowerVertexAssociated && this->IsVertexAssociated(pNearbyCluster, pVertex, vertexAssociationMap))
-                continue;
-
             if (bestClusterMerge.GetParentCluster() && (bestClusterMerge.GetBoundedFraction1() > m_coneBoundedFraction1) && (bestClusterMerge.GetBoundedFraction2() > m_coneBoundedFraction2))
                 clusterMergeMap[pNearbyCluster].push_back(bestClusterMerge);
         }
@@ -183,6 +193,33 @@ void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVerte
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool SlidingConePfoMopUpAlgorithm::CouldBeBounded(const SimpleCone &simpleCone, const float coneLength, const ClusterExtent &clusterExtent) const
+{
+    const CartesianVector &coneDirection(simpleCone.GetConeDirection());
+    const float directionMagnitude(coneDirection.GetMagnitude());
+
+    if (directionMagnitude < std::numeric_limits<float>::epsilon())
+        return true;
+
+    // ATTN Widen the sphere to allow for rounding in the per-hit calculations
+    const float radius(1.01f * clusterExtent.m_radius + 0.1f);
+    const CartesianVector displacement(clusterExtent.m_centre - simpleCone.GetConeApex());
+    const float rL(displacement.GetDotProduct(coneDirection));
+
+    if ((rL + radius * directionMagnitude < 0.f) || (rL - radius * directionMagnitude > coneLength))
+        return false;
+
+    // Distance from sphere centre to the cone is at least its distance to the plane containing the cone axis and nearest cone boundary line
+    const float tanHalfAngle(std::max(0.f, std::max(m_coneTanHalfAngle1, m_coneTanHalfAngle2)));
+    const float cosHalfAngle(1.f / std::sqrt(1.f + tanHalfAngle * tanHalfAngle));
+    const float longitudinal(rL / directionMagnitude);
+    const float transverse(displacement.GetCrossProduct(coneDirection).GetMagnitude() / directionMagnitude);
+
+    return ((transverse - tanHalfAngle * longitudinal) * cosHalfAngle <= radius);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool SlidingConePfoMopUpAlgorithm::IsVertexAssociated(const Cluster *const pCluster, const Vertex *const pVertex,
     VertexAssociationMap &vertexAssociationMap, const ThreeDSlidingFitResult *const pSlidingFitResult) const
 {
@@ -295,6 +332,33 @@ bool SlidingConePfoMopUpAlgorithm::ClusterMerge::operator<(const ClusterMerge &r
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+SlidingConePfoMopUpAlgorithm::ClusterExtent::ClusterExtent(const Cluster *const pCluster) :
+    m_centre(0.f, 0.f, 0.f),
+    m_radius(0.f)
+{
+    LArClusterHelper::GetCoordinateVector(pCluster, m_hitPositions);
+
+    if (m_hitPositions.empty())
+        return;
+
+    float minX(std::numeric_limits<float>::max()), minY(std::numeric_limits<float>::max()), minZ(std::numeric_limits<float>::max());
+    float maxX(-std::numeric_limits<float>::max()), maxY(-std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const CartesianVector &hitPosition : m_hitPositions)
+    {
+        minX = std::min(minX, hitPosition.GetX()); maxX = std::max(maxX, hitPosition.GetX());
+        minY = std::min(minY, hitPosition.GetY()); maxY = std::max(maxY, hitPosition.GetY());
+        minZ = std::min(minZ, hitPosition.GetZ()); maxZ = std::max(maxZ, hitPosition.GetZ());
+    }
+
+    const CartesianVector minPosition(minX, minY, minZ), maxPosition(maxX, maxY, maxZ);
+    m_centre = (minPosition + maxPosition) * 0.5f;
+    m_radius = 0.5f * (maxPosition - minPosition).GetMagnitude();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode SlidingConePfoMopUpAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
@@ -15,6 +15,10 @@
 namespace lar_content
 {
 
+class SimpleCone;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  SlidingConePfoMopUpAlgorithm class
  */
@@ -80,6 +84,26 @@ private:
 
     typedef std::vector<ClusterMerge> ClusterMergeList;
 
+    /**
+     *  @brief  ClusterExtent class, the hit positions of a 3d cluster and a sphere bounding them
+     */
+    class ClusterExtent
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         * 
+         *  @param  pCluster the address of the 3d cluster
+         */
+        ClusterExtent(const pandora::Cluster *const pCluster);
+
+        pandora::CartesianPointVector   m_hitPositions;     ///< The cluster hit positions
+        pandora::CartesianVector        m_centre;           ///< The centre of the bounding sphere
+        float                           m_radius;           ///< The radius of the bounding sphere
+    };
+
+    typedef std::unordered_map<const pandora::Cluster*, ClusterExtent> ClusterExtentMap;
+
     pandora::StatusCode Run();
 
     /**
@@ -112,6 +136,17 @@ private:
     void GetClusterMergeMap(const pandora::Vertex *const pVertex, const pandora::ClusterVector &clusters3D, const ClusterToPfoMap &clusterToPfoMap,
         ClusterMergeMap &clusterMergeMap) const;
 
+    /**
+     *  @brief  Whether the hits of a cluster could lie within a cone, using the cluster bounding sphere and the larger of the configured cone angles
+     * 
+     *  @param  simpleCone the cone
+     *  @param  coneLength the cone length
+     *  @param  clusterExtent the cluster extent
+     * 
+     *  @return boolean, false only if the bounding sphere is certain to lie entirely outside the cone
+     */
+    bool CouldBeBounded(const SimpleCone &simpleCone, const float coneLength, const ClusterExtent &clusterExtent) const;
+
     typedef std::unordered_map<const pandora::Cluster*, bool> VertexAssociationMap;
 
     /**
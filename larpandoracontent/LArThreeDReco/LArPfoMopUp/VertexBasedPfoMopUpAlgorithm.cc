@@ -57,6 +57,9 @@ StatusCode VertexBasedPfoMopUpAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    // ATTN Association details are cached across passes; a merge only changes those involving the merged pfos
+    this->ClearAssociationCache();
+
     while (true)
     {
         PfoList vertexPfos, nonVertexPfos;
@@ -72,6 +75,7 @@ StatusCode VertexBasedPfoMopUpAlgorithm::Run()
             break;
     }
 
+    this->ClearAssociationCache();
     return STATUS_CODE_SUCCESS;
 }
 
@@ -111,7 +115,12 @@ void VertexBasedPfoMopUpAlgorithm::GetInputPfos(const Vertex *const pVertex, Pfo
 
         for (const Pfo *const pPfo : *pPfoList)
         {
-            PfoList &pfoTargetList(this->IsVertexAssociated(pPfo, pVertex) ? vertexPfos : nonVertexPfos);
+            PfoToVertexAssociationMap::const_iterator iter(m_vertexAssociationMap.find(pPfo));
+
+            if (m_vertexAssociationMap.end() == iter)
+                iter = m_vertexAssociationMap.insert(PfoToVertexAssociationMap::value_type(pPfo, this->IsVertexAssociated(pPfo, pVertex))).first;
+
+            PfoList &pfoTargetList(iter->second ? vertexPfos : nonVertexPfos);
             pfoTargetList.push_back(pPfo);
         }
     }
@@ -158,12 +167,28 @@ void VertexBasedPfoMopUpAlgorithm::GetPfoAssociations(const Vertex *const pVerte
     {
         for (const Pfo *const pDaughterPfo : nonVertexPfos)
         {
-            try
+            const PfoPair pfoPair(pVertexPfo, pDaughterPfo);
+
+            if (m_failedPfoPairs.count(pfoPair))
+                continue;
+
+            PfoPairToAssociationMap::const_iterator iter(m_pfoAssociationMap.find(pfoPair));
+
+            if (m_pfoAssociationMap.end() == iter)
             {
-                const PfoAssociation pfoAssociation(this->GetPfoAssociation(pVertex, pVertexPfo, pDaughterPfo));
-                pfoAssociationList.push_back(pfoAssociation);
+                try
+                {
+                    const PfoAssociation pfoAssociation(this->GetPfoAssociation(pVertex, pVertexPfo, pDaughterPfo));
+                    iter = m_pfoAssociationMap.insert(PfoPairToAssociationMap::value_type(pfoPair, pfoAssociation)).first;
+                }
+                catch (StatusCodeException &)
+                {
+                    m_failedPfoPairs.insert(pfoPair);
+                    continue;
+                }
             }
-            catch (StatusCodeException &) {}
+
+            pfoAssociationList.push_back(iter->second);
         }
     }
 }
@@ -202,16 +227,21 @@ VertexBasedPfoMopUpAlgorithm::PfoAssociation VertexBasedPfoMopUpAlgorithm::GetPf
 VertexBasedPfoMopUpAlgorithm::ClusterAssociation VertexBasedPfoMopUpAlgorithm::GetClusterAssociation(const Vertex *const pVertex,
     const Cluster *const pVertexCluster, const Cluster *const pDaughterCluster) const
 {
-    const HitType vertexHitType(LArClusterHelper::GetClusterHitType(pVertexCluster));
-    const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), vertexHitType));
+    ClusterToConeParametersMap::const_iterator coneIter(m_coneParametersMap.find(pVertexCluster));
+
+    if (m_coneParametersMap.end() == coneIter)
+    {
+        const HitType vertexHitType(LArClusterHelper::GetClusterHitType(pVertexCluster));
+        const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), vertexHitType));
+
+        const ConeParameters coneParameters(pVertexCluster, vertexPosition2D, m_coneAngleCentile, m_maxConeCosHalfAngle);
+        coneIter = m_coneParametersMap.insert(ClusterToConeParametersMap::value_type(pVertexCluster, coneParameters)).first;
+    }
 
-    const ConeParameters coneParameters(pVertexCluster, vertexPosition2D, m_coneAngleCentile, m_maxConeCosHalfAngle);
-    const float boundedFraction(coneParameters.GetBoundedFraction(pDaughterCluster, m_maxConeLengthMultiplier));
+    const float boundedFraction(coneIter->second.GetBoundedFraction(pDaughterCluster, m_maxConeLengthMultiplier));
 
-    const LArVertexHelper::ClusterDirection vertexClusterDirection(LArVertexHelper::GetClusterDirectionInZ(this->GetPandora(), pVertex,
-        pVertexCluster, m_directionTanAngle, m_directionApexShift));
-    const LArVertexHelper::ClusterDirection daughterClusterDirection(LArVertexHelper::GetClusterDirectionInZ(this->GetPandora(), pVertex,
-        pDaughterCluster, m_directionTanAngle, m_directionApexShift));
+    const LArVertexHelper::ClusterDirection vertexClusterDirection(this->GetClusterDirection(pVertex, pVertexCluster));
+    const LArVertexHelper::ClusterDirection daughterClusterDirection(this->GetClusterDirection(pVertex, pDaughterCluster));
     const bool isConsistentDirection(vertexClusterDirection == daughterClusterDirection);
 
     return ClusterAssociation(pVertexCluster, pDaughterCluster, boundedFraction, isConsistentDirection);
@@ -273,6 +303,8 @@ void VertexBasedPfoMopUpAlgorithm::MergePfos(const PfoAssociation &pfoAssociatio
     const Pfo *pDaughterPfo(pfoAssociation.GetDaughterPfo());
     const bool isDaughterShower(pShowerPfoList && (pShowerPfoList->end() != std::find(pShowerPfoList->begin(), pShowerPfoList->end(), pDaughterPfo)));
 
+    this->RemoveFromAssociationCache(pVertexPfo);
+    this->RemoveFromAssociationCache(pDaughterPfo);
     this->MergeAndDeletePfos(pVertexPfo, pDaughterPfo);
 
     if (isvertexTrack && isDaughterShower)
@@ -287,6 +319,70 @@ void VertexBasedPfoMopUpAlgorithm::MergePfos(const PfoAssociation &pfoAssociatio
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArVertexHelper::ClusterDirection VertexBasedPfoMopUpAlgorithm::GetClusterDirection(const Vertex *const pVertex, const Cluster *const pCluster) const
+{
+    ClusterToDirectionMap::const_iterator iter(m_clusterDirectionMap.find(pCluster));
+
+    if (m_clusterDirectionMap.end() != iter)
+        return iter->second;
+
+    const LArVertexHelper::ClusterDirection clusterDirection(LArVertexHelper::GetClusterDirectionInZ(this->GetPandora(), pVertex,
+        pCluster, m_directionTanAngle, m_directionApexShift));
+    m_clusterDirectionMap.insert(ClusterToDirectionMap::value_type(pCluster, clusterDirection));
+
+    return clusterDirection;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VertexBasedPfoMopUpAlgorithm::RemoveFromAssociationCache(const Pfo *const pPfo) const
+{
+    m_vertexAssociationMap.erase(pPfo);
+
+    for (PfoPairToAssociationMap::iterator iter = m_pfoAssociationMap.begin(); iter != m_pfoAssociationMap.end(); )
+    {
+        if ((pPfo == iter->first.first) || (pPfo == iter->first.second))
+        {
+            iter = m_pfoAssociationMap.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    for (PfoPairSet::iterator iter = m_failedPfoPairs.begin(); iter != m_failedPfoPairs.end(); )
+    {
+        if ((pPfo == iter->first) || (pPfo == iter->second))
+        {
+            iter = m_failedPfoPairs.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    for (const Cluster *const pCluster : pPfo->GetClusterList())
+    {
+        m_coneParametersMap.erase(pCluster);
+        m_clusterDirectionMap.erase(pCluster);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VertexBasedPfoMopUpAlgorithm::ClearAssociationCache()
+{
+    m_vertexAssociationMap.clear();
+    m_pfoAssociationMap.clear();
+    m_failedPfoPairs.clear();
+    m_coneParametersMap.clear();
+    m_clusterDirectionMap.clear();
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -8,6 +8,8 @@
 #ifndef LAR_VERTEX_BASED_PFO_MOP_UP_ALGORITHM_H
 #define LAR_VERTEX_BASED_PFO_MOP_UP_ALGORITHM_H 1
 
+#include "larpandoracontent/LArHelpers/LArVertexHelper.h"
+
 #include "larpandoracontent/LArUtility/PfoMopUpBaseAlgorithm.h"
 
 #include <unordered_map>
@@ -338,11 +340,40 @@ protected:
      */
     void MergePfos(const PfoAssociation &pfoAssociation) const;
 
+    /**
+     *  @brief  Get the direction in z of a cluster, using the association cache where possible
+     * 
+     *  @param  pVertex the address of the vertex
+     *  @param  pCluster the address of the cluster
+     * 
+     *  @return the cluster direction in z
+     */
+    LArVertexHelper::ClusterDirection GetClusterDirection(const pandora::Vertex *const pVertex, const pandora::Cluster *const pCluster) const;
+
+    /**
+     *  @brief  Remove all cached association details involving a pfo, or any of its clusters, from the association cache
+     * 
+     *  @param  pPfo the address of the pfo
+     */
+    void RemoveFromAssociationCache(const pandora::Pfo *const pPfo) const;
+
+    /**
+     *  @brief  Clear the association cache
+     */
+    void ClearAssociationCache();
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::set<pandora::HitType> HitTypeSet;
     typedef std::map<pandora::HitType, const pandora::Cluster*> HitTypeToClusterMap;
 
+    typedef std::pair<const pandora::Pfo*, const pandora::Pfo*> PfoPair;
+    typedef std::map<PfoPair, PfoAssociation> PfoPairToAssociationMap;
+    typedef std::set<PfoPair> PfoPairSet;
+    typedef std::unordered_map<const pandora::Pfo*, bool> PfoToVertexAssociationMap;
+    typedef std::unordered_map<const pandora::Cluster*, ConeParameters> ClusterToConeParametersMap;
+    typedef std::unordered_map<const pandora::Cluster*, LArVertexHelper::ClusterDirection> ClusterToDirectionMap;
+
     std::string             m_trackPfoListName;                 ///< The input track pfo list name
     std::string             m_showerPfoListName;                ///< The input shower pfo list name
 
@@ -363,6 +394,12 @@ protected:
 
     unsigned int            m_minConsistentDirections;          ///< The minimum number of consistent cluster directions to allow a pfo merge
     unsigned int            m_minConsistentDirectionsTrack;     ///< The minimum number of consistent cluster directions to allow a merge involving a track pfo
+
+    mutable PfoToVertexAssociationMap   m_vertexAssociationMap;     ///< The cached vertex association decision for each input pfo
+    mutable PfoPairToAssociationMap     m_pfoAssociationMap;        ///< The cached association details for each (vertex pfo, daughter pfo) pair
+    mutable PfoPairSet                  m_failedPfoPairs;           ///< The (vertex pfo, daughter pfo) pairs for which no association could be made
+    mutable ClusterToConeParametersMap  m_coneParametersMap;        ///< The cached cone parameters for each vertex cluster
+    mutable ClusterToDirectionMap       m_clusterDirectionMap;      ///< The cached direction in z for each cluster
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
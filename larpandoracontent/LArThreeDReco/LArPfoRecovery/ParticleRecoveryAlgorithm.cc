@@ -35,7 +35,8 @@ ParticleRecoveryAlgorithm::ParticleRecoveryAlgorithm() :
     m_minXOverlapFractionGaps(0.75f),
     m_sampleStepSize(0.5f),
     m_slidingFitHalfWindow(10),
-    m_pseudoChi2Cut(5.f)
+    m_pseudoChi2Cut(5.f),
+    m_detectorGapIndex(DetectorGapList())
 {
 }
 
@@ -43,6 +44,8 @@ ParticleRecoveryAlgorithm::ParticleRecoveryAlgorithm() :
 
 StatusCode ParticleRecoveryAlgorithm::Run()
 {
+    m_detectorGapIndex = LArGeometryHelper::DetectorGapIndex(this->GetPandora().GetGeometry()->GetDetectorGapList());
+
     ClusterList inputClusterListU, inputClusterListV, inputClusterListW;
     this->GetInputClusters(inputClusterListU, inputClusterListV, inputClusterListW);
 
@@ -57,6 +60,9 @@ StatusCode ParticleRecoveryAlgorithm::Run()
     this->FindOverlaps(selectedClusterListW, selectedClusterListU, overlapTensor);
     this->ExamineTensor(overlapTensor);
 
+    m_slidingFitResultMap.clear();
+    m_failedSlidingFitClusters.clear();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -183,35 +189,186 @@ void ParticleRecoveryAlgorithm::VertexClusterSelection(const ClusterList &inputC
 
 void ParticleRecoveryAlgorithm::FindOverlaps(const ClusterList &clusterList1, const ClusterList &clusterList2, SimpleOverlapTensor &overlapTensor) const
 {
-    for (ClusterList::const_iterator iter1 = clusterList1.begin(), iter1End = clusterList1.end(); iter1 != iter1End; ++iter1)
+    if (clusterList1.empty() || clusterList2.empty())
+        return;
+
+    ClusterXSpanVector clusterXSpans1, clusterXSpans2;
+    this->GetClusterXSpans(clusterList1, clusterXSpans1);
+    this->GetClusterXSpans(clusterList2, clusterXSpans2);
+
+    if (m_checkGaps && !PandoraContentApi::GetGeometry(*this)->GetDetectorGapList().empty())
+    {
+        float xMin(std::numeric_limits<float>::max()), xMax(-std::numeric_limits<float>::max());
+
+        for (const ClusterXSpan &clusterXSpan : clusterXSpans1)
+        {
+            xMin = std::min(xMin, clusterXSpan.m_xMin);
+            xMax = std::max(xMax, clusterXSpan.m_xMax);
+        }
+
+        for (const ClusterXSpan &clusterXSpan : clusterXSpans2)
+        {
+            xMin = std::min(xMin, clusterXSpan.m_xMin);
+            xMax = std::max(xMax, clusterXSpan.m_xMax);
+        }
+
+        for (ClusterXSpan &clusterXSpan : clusterXSpans1)
+            this->SetEffectiveSpanBounds(xMin, xMax, clusterXSpan);
+
+        for (ClusterXSpan &clusterXSpan : clusterXSpans2)
+            this->SetEffectiveSpanBounds(xMin, xMax, clusterXSpan);
+    }
+
+    CandidateIndices candidateIndices;
+
+    if (m_minXOverlapFraction > 0.f)
+    {
+        this->GetOverlapCandidates(clusterXSpans1, clusterXSpans2, candidateIndices);
+    }
+    else
     {
-        for (ClusterList::const_iterator iter2 = clusterList2.begin(), iter2End = clusterList2.end(); iter2 != iter2End; ++iter2)
+        // ATTN Non-overlapping clusters can satisfy a non-positive overlap fraction cut, so all pairs must be considered
+        candidateIndices.resize(clusterXSpans1.size());
+
+        for (std::vector<unsigned int> &indices : candidateIndices)
         {
-            if (this->IsOverlap(*iter1, *iter2))
-                overlapTensor.AddAssociation(*iter1, *iter2);
+            for (unsigned int index2 = 0; index2 < clusterXSpans2.size(); ++index2)
+                indices.push_back(index2);
+        }
+    }
+
+    for (unsigned int index1 = 0; index1 < clusterXSpans1.size(); ++index1)
+    {
+        for (const unsigned int index2 : candidateIndices.at(index1))
+        {
+            if (this->IsOverlap(clusterXSpans1.at(index1), clusterXSpans2.at(index2)))
+                overlapTensor.AddAssociation(clusterXSpans1.at(index1).m_pCluster, clusterXSpans2.at(index2).m_pCluster);
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool ParticleRecoveryAlgorithm::IsOverlap(const Cluster *const pCluster1, const Cluster *const pCluster2) const
+void ParticleRecoveryAlgorithm::GetClusterXSpans(const ClusterList &clusterList, ClusterXSpanVector &clusterXSpanVector) const
 {
-    if (LArClusterHelper::GetClusterHitType(pCluster1) == LArClusterHelper::GetClusterHitType(pCluster2))
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    for (const Cluster *const pCluster : clusterList)
+    {
+        if (0 == pCluster->GetNCaloHits())
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    if ((0 == pCluster1->GetNCaloHits()) || (0 == pCluster2->GetNCaloHits()))
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+        const ClusterXSpan clusterXSpan(pCluster);
 
-    float xMin1(0.f), xMax1(0.f), xMin2(0.f), xMax2(0.f);
-    LArClusterHelper::GetClusterSpanX(pCluster1, xMin1, xMax1);
-    LArClusterHelper::GetClusterSpanX(pCluster2, xMin2, xMax2);
+        if ((clusterXSpan.m_xMax - clusterXSpan.m_xMin) < std::numeric_limits<float>::epsilon())
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    const float xSpan1(xMax1 - xMin1), xSpan2(xMax2 - xMin2);
+        clusterXSpanVector.push_back(clusterXSpan);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ParticleRecoveryAlgorithm::SetEffectiveSpanBounds(const float xMin, const float xMax, ClusterXSpan &clusterXSpan) const
+{
+    // ATTN Follows CalculateEffectiveSpan using the widest range; for any partner, sampling stops at or before the first point found here
+    // not to be in a gap (or for which the gap check fails), as sampling points only differ once clamped to a narrower range
+    const float xMinEff(clusterXSpan.m_xMin), xMaxEff(clusterXSpan.m_xMax);
+
+    try
+    {
+        const TwoDSlidingFitResult &slidingFitResult(this->GetCachedSlidingFitResult(clusterXSpan.m_pCluster));
+        const int nSamplingPointsLeft(1 + static_cast<int>((xMinEff - xMin) / m_sampleStepSize));
+
+        for (int iSample = 1; iSample <= nSamplingPointsLeft; ++iSample)
+        {
+            const float xSample(std::max(xMin, xMinEff - static_cast<float>(iSample) * m_sampleStepSize));
+            clusterXSpan.m_xMinBound = xSample - m_sampleStepSize;
 
-    if ((xSpan1 < std::numeric_limits<float>::epsilon()) || (xSpan2 < std::numeric_limits<float>::epsilon()))
+            if (!LArGeometryHelper::IsXSamplingPointInGap(m_detectorGapIndex, xSample, slidingFitResult, m_sampleStepSize))
+                break;
+        }
+    }
+    catch (StatusCodeException &) {}
+
+    try
+    {
+        const TwoDSlidingFitResult &slidingFitResult(this->GetCachedSlidingFitResult(clusterXSpan.m_pCluster));
+        const int nSamplingPointsRight(1 + static_cast<int>((xMax - xMaxEff) / m_sampleStepSize));
+
+        for (int iSample = 1; iSample <= nSamplingPointsRight; ++iSample)
+        {
+            const float xSample(std::min(xMax, xMaxEff + static_cast<float>(iSample) * m_sampleStepSize));
+            clusterXSpan.m_xMaxBound = xSample + m_sampleStepSize;
+
+            if (!LArGeometryHelper::IsXSamplingPointInGap(m_detectorGapIndex, xSample, slidingFitResult, m_sampleStepSize))
+                break;
+        }
+    }
+    catch (StatusCodeException &) {}
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ParticleRecoveryAlgorithm::GetOverlapCandidates(const ClusterXSpanVector &clusterXSpans1, const ClusterXSpanVector &clusterXSpans2,
+    CandidateIndices &candidateIndices) const
+{
+    typedef std::pair<float, std::pair<unsigned int, unsigned int> > SweepEntry;
+    std::vector<SweepEntry> sweepEntries;
+
+    for (unsigned int index = 0; index < clusterXSpans1.size(); ++index)
+        sweepEntries.push_back(SweepEntry(clusterXSpans1.at(index).m_xMinBound, std::make_pair(0, index)));
+
+    for (unsigned int index = 0; index < clusterXSpans2.size(); ++index)
+        sweepEntries.push_back(SweepEntry(clusterXSpans2.at(index).m_xMinBound, std::make_pair(1, index)));
+
+    std::sort(sweepEntries.begin(), sweepEntries.end());
+    candidateIndices.assign(clusterXSpans1.size(), std::vector<unsigned int>());
+
+    // Each span is compared with the still-open spans from the other list, which start no later and are removed once they end
+    std::vector<unsigned int> activeIndices1, activeIndices2;
+
+    for (const SweepEntry &sweepEntry : sweepEntries)
+    {
+        const float xMinBound(sweepEntry.first);
+        const bool isFirstList(0 == sweepEntry.second.first);
+        const unsigned int index(sweepEntry.second.second);
+
+        const ClusterXSpanVector &otherClusterXSpans(isFirstList ? clusterXSpans2 : clusterXSpans1);
+        std::vector<unsigned int> &otherActiveIndices(isFirstList ? activeIndices2 : activeIndices1);
+
+        otherActiveIndices.erase(std::remove_if(otherActiveIndices.begin(), otherActiveIndices.end(),
+            [&otherClusterXSpans, xMinBound](const unsigned int otherIndex) { return (otherClusterXSpans.at(otherIndex).m_xMaxBound < xMinBound); }),
+            otherActiveIndices.end());
+
+        for (const unsigned int otherIndex : otherActiveIndices)
+        {
+            if (isFirstList)
+            {
+                candidateIndices.at(index).push_back(otherIndex);
+            }
+            else
+            {
+                candidateIndices.at(otherIndex).push_back(index);
+            }
+        }
+
+        (isFirstList ? activeIndices1 : activeIndices2).push_back(index);
+    }
+
+    for (std::vector<unsigned int> &indices : candidateIndices)
+        std::sort(indices.begin(), indices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParticleRecoveryAlgorithm::IsOverlap(const ClusterXSpan &clusterXSpan1, const ClusterXSpan &clusterXSpan2) const
+{
+    const Cluster *const pCluster1(clusterXSpan1.m_pCluster), *const pCluster2(clusterXSpan2.m_pCluster);
+
+    if (LArClusterHelper::GetClusterHitType(pCluster1) == LArClusterHelper::GetClusterHitType(pCluster2))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    const float xMin1(clusterXSpan1.m_xMin), xMax1(clusterXSpan1.m_xMax), xMin2(clusterXSpan2.m_xMin), xMax2(clusterXSpan2.m_xMax);
+    const float xSpan1(xMax1 - xMin1), xSpan2(xMax2 - xMin2);
     const float xOverlap(std::min(xMax1, xMax2) - std::max(xMin1, xMin2));
 
     float xOverlapFraction1(xOverlap / xSpan1), xOverlapFraction2(xOverlap / xSpan2);
@@ -254,12 +411,10 @@ void ParticleRecoveryAlgorithm::CalculateEffectiveOverlapFractions(const Cluster
 
 void ParticleRecoveryAlgorithm::CalculateEffectiveSpan(const pandora::Cluster *const pCluster, const float xMin, const float xMax, float &xMinEff, float &xMaxEff) const
 {
-    // TODO cache sliding linear fit results and optimise protection against exceptions from TwoDSlidingFitResult and IsXSamplingPointInGap
+    // TODO optimise protection against exceptions from TwoDSlidingFitResult and IsXSamplingPointInGap
     try
     {
-        const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch);
+        const TwoDSlidingFitResult &slidingFitResult(this->GetCachedSlidingFitResult(pCluster));
 
         const int nSamplingPointsLeft(1 + static_cast<int>((xMinEff - xMin) / m_sampleStepSize));
         const int nSamplingPointsRight(1 + static_cast<int>((xMax - xMaxEff) / m_sampleStepSize));
@@ -269,7 +424,7 @@ void ParticleRecoveryAlgorithm::CalculateEffectiveSpan(const pandora::Cluster *c
         {
             const float xSample(std::max(xMin, xMinEff - static_cast<float>(iSample) * m_sampleStepSize));
 
-            if (!LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult, m_sampleStepSize))
+            if (!LArGeometryHelper::IsXSamplingPointInGap(m_detectorGapIndex, xSample, slidingFitResult, m_sampleStepSize))
                 break;
 
             dxMin = xMinEff - xSample;
@@ -279,7 +434,7 @@ void ParticleRecoveryAlgorithm::CalculateEffectiveSpan(const pandora::Cluster *c
         {
             const float xSample(std::min(xMax, xMaxEff + static_cast<float>(iSample) * m_sampleStepSize));
 
-            if (!LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult, m_sampleStepSize))
+            if (!LArGeometryHelper::IsXSamplingPointInGap(m_detectorGapIndex, xSample, slidingFitResult, m_sampleStepSize))
                 break;
 
             dxMax = xSample - xMaxEff;
@@ -293,6 +448,31 @@ void ParticleRecoveryAlgorithm::CalculateEffectiveSpan(const pandora::Cluster *c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const TwoDSlidingFitResult &ParticleRecoveryAlgorithm::GetCachedSlidingFitResult(const Cluster *const pCluster) const
+{
+    TwoDSlidingFitResultMap::const_iterator iter(m_slidingFitResultMap.find(pCluster));
+
+    if (m_slidingFitResultMap.end() != iter)
+        return iter->second;
+
+    if (m_failedSlidingFitClusters.count(pCluster))
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    try
+    {
+        const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch);
+        return m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).first->second;
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        m_failedSlidingFitClusters.insert(pCluster);
+        throw statusCodeException;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ParticleRecoveryAlgorithm::ExamineTensor(const SimpleOverlapTensor &overlapTensor) const
 {
     ClusterVector sortedKeyClusters(overlapTensor.GetKeyClusters().begin(), overlapTensor.GetKeyClusters().end());
@@ -400,6 +580,21 @@ void ParticleRecoveryAlgorithm::CreateTrackParticle(const ClusterList &clusterLi
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ParticleRecoveryAlgorithm::ClusterXSpan::ClusterXSpan(const Cluster *const pCluster) :
+    m_pCluster(pCluster),
+    m_xMin(0.f),
+    m_xMax(0.f),
+    m_xMinBound(0.f),
+    m_xMaxBound(0.f)
+{
+    LArClusterHelper::GetClusterSpanX(pCluster, m_xMin, m_xMax);
+    m_xMinBound = m_xMin;
+    m_xMaxBound = m_xMax;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ParticleRecoveryAlgorithm::SimpleOverlapTensor::AddAssociation(const Cluster *const pCluster1, const Cluster *const pCluster2)
 {
     const HitType hitType1(LArClusterHelper::GetClusterHitType(pCluster1));
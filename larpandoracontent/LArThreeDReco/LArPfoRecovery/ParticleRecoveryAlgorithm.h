@@ -10,6 +10,10 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
 #include <unordered_map>
 
 namespace lar_content
@@ -69,6 +73,28 @@ private:
         ClusterNavigationMap    m_clusterNavigationMapWU;       ///< The cluster navigation map W->U
     };
 
+    /**
+     *  @brief  ClusterXSpan class, the x span of a cluster and the widest x range its effective span could cover when gaps are considered
+     */
+    class ClusterXSpan
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         * 
+         *  @param  pCluster address of the cluster
+         */
+        ClusterXSpan(const pandora::Cluster *const pCluster);
+
+        const pandora::Cluster *m_pCluster;         ///< The address of the cluster
+        float                   m_xMin;             ///< The min x value of the cluster
+        float                   m_xMax;             ///< The max x value of the cluster
+        float                   m_xMinBound;        ///< The lowest possible min x value of the effective span of the cluster
+        float                   m_xMaxBound;        ///< The highest possible max x value of the effective span of the cluster
+    };
+
+    typedef std::vector<ClusterXSpan> ClusterXSpanVector;
+
     pandora::StatusCode Run();
 
     /**
@@ -113,13 +139,41 @@ private:
      */
     void FindOverlaps(const pandora::ClusterList &clusterList1, const pandora::ClusterList &clusterList2, SimpleOverlapTensor &overlapTensor) const;
 
+    /**
+     *  @brief  Get the x spans of the clusters in a list, checking that each cluster has hits and a non-zero x span
+     *
+     *  @param  clusterList the cluster list
+     *  @param  clusterXSpanVector to receive the cluster x spans, in cluster list order
+     */
+    void GetClusterXSpans(const pandora::ClusterList &clusterList, ClusterXSpanVector &clusterXSpanVector) const;
+
+    /**
+     *  @brief  Set the bounds on the effective x span of a cluster, when gaps are considered with respect to any partner cluster
+     *
+     *  @param  xMin the min x value of all clusters that may be considered
+     *  @param  xMax the max x value of all clusters that may be considered
+     *  @param  clusterXSpan the cluster x span, to receive the bounds on its effective x span
+     */
+    void SetEffectiveSpanBounds(const float xMin, const float xMax, ClusterXSpan &clusterXSpan) const;
+
+    typedef std::vector<std::vector<unsigned int> > CandidateIndices;
+
+    /**
+     *  @brief  Find the pairs of clusters whose possible effective x spans overlap, using a sweep over the x span bounds
+     *
+     *  @param  clusterXSpans1 the cluster x spans for the first cluster list
+     *  @param  clusterXSpans2 the cluster x spans for the second cluster list
+     *  @param  candidateIndices to receive, for each cluster in the first list, the ordered indices of candidate clusters in the second list
+     */
+    void GetOverlapCandidates(const ClusterXSpanVector &clusterXSpans1, const ClusterXSpanVector &clusterXSpans2, CandidateIndices &candidateIndices) const;
+
     /**
      *  @brief  Whether two clusters overlap convincingly in x
      *
-     *  @param  pCluster1 address of the first cluster
-     *  @param  pCluster2 address of the second cluster
+     *  @param  clusterXSpan1 the x span of the first cluster
+     *  @param  clusterXSpan2 the x span of the second cluster
      */
-    bool IsOverlap(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2) const;
+    bool IsOverlap(const ClusterXSpan &clusterXSpan1, const ClusterXSpan &clusterXSpan2) const;
 
     /**
      *  @brief Calculate effective overlap fractions taking into account gaps
@@ -147,6 +201,15 @@ private:
      */
     void CalculateEffectiveSpan(const pandora::Cluster *const pCluster, const float xMin, const float xMax, float &xMinEff, float &xMaxEff) const;
 
+    /**
+     *  @brief  Get the sliding fit result for a cluster, using the cache where possible
+     * 
+     *  @param  pCluster address of the cluster
+     * 
+     *  @return the sliding fit result, throwing if the fit cannot be made
+     */
+    const TwoDSlidingFitResult &GetCachedSlidingFitResult(const pandora::Cluster *const pCluster) const;
+
     /**
      *  @brief  Identify unambiguous cluster overlaps and resolve ambiguous overlaps, creating new track particles
      *
@@ -192,6 +255,10 @@ private:
     float                       m_sampleStepSize;               ///< The sampling step size used in association checks, units cm
     unsigned int                m_slidingFitHalfWindow;         ///< The half window for the fit sliding result constructor
     float                       m_pseudoChi2Cut;                ///< The selection cut on the matched chi2
+
+    mutable TwoDSlidingFitResultMap m_slidingFitResultMap;      ///< The cached sliding fit results, used in effective span calculations
+    mutable pandora::ClusterSet     m_failedSlidingFitClusters; ///< The clusters for which no sliding fit result could be made
+    LArGeometryHelper::DetectorGapIndex m_detectorGapIndex;     ///< The index of the detector gaps, rebuilt from the gap list for each run
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 using namespace pandora;
 
@@ -108,6 +109,8 @@ void ThreeDRemnantsAlgorithm::ExamineTensor()
 
     for (RemnantTensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd; )
     {
+        const LArProfilingHelper::ScopedTimer scopedTimer(*iter);
+
         if ((*iter)->Run(this, m_overlapTensor))
         {
             iter = m_algorithmToolVector.begin();
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArShowerMatching/ThreeDShowersAlgorithm.h"
 
@@ -141,6 +142,7 @@ void ThreeDShowersAlgorithm::PreparationStep(ClusterList &clusterList)
 void ThreeDShowersAlgorithm::TidyUp()
 {
     m_slidingFitResultMap.clear();
+    m_hitCoordinateMap.clear();
     return ThreeDBaseAlgorithm<ShowerOverlapResult>::TidyUp();
 }
 
@@ -153,6 +155,20 @@ void ThreeDShowersAlgorithm::AddToSlidingFitCache(const Cluster *const pCluster)
 
     if (!m_slidingFitResultMap.insert(TwoDSlidingShowerFitResultMap::value_type(pCluster, slidingShowerFitResult)).second)
         throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    HitCoordinateVector hitCoordinateVector;
+    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+
+    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    {
+        for (const CaloHit *const pCaloHit : *iter->second)
+            hitCoordinateVector.push_back(HitCoordinateVector::value_type(pCaloHit->GetPositionVector().GetX(), pCaloHit->GetPositionVector().GetZ()));
+    }
+
+    std::sort(hitCoordinateVector.begin(), hitCoordinateVector.end());
+
+    if (!m_hitCoordinateMap.insert(HitCoordinateMap::value_type(pCluster, hitCoordinateVector)).second)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -163,6 +179,8 @@ void ThreeDShowersAlgorithm::RemoveFromSlidingFitCache(const Cluster *const pClu
 
     if (m_slidingFitResultMap.end() != iter)
         m_slidingFitResultMap.erase(iter);
+
+    m_hitCoordinateMap.erase(pCluster);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -189,7 +207,7 @@ StatusCode ThreeDShowersAlgorithm::CalculateOverlapResult(const Cluster *const p
     if (xSampling.m_xOverlapSpan < std::numeric_limits<float>::epsilon())
         return STATUS_CODE_NOT_FOUND;
 
-    ShowerPositionMapPair positionMapsU, positionMapsV, positionMapsW;
+    ShowerPositionArrayPair positionMapsU, positionMapsV, positionMapsW;
     this->GetShowerPositionMaps(fitResultU, fitResultV, fitResultW, xSampling, positionMapsU, positionMapsV, positionMapsW);
 
     unsigned int nSampledHitsU(0), nMatchedHitsU(0);
@@ -220,10 +238,18 @@ StatusCode ThreeDShowersAlgorithm::CalculateOverlapResult(const Cluster *const p
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ThreeDShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFitResult &fitResultU, const TwoDSlidingShowerFitResult &fitResultV,
-    const TwoDSlidingShowerFitResult &fitResultW, const XSampling &xSampling, ShowerPositionMapPair &positionMapsU, ShowerPositionMapPair &positionMapsV,
-    ShowerPositionMapPair &positionMapsW) const
+    const TwoDSlidingShowerFitResult &fitResultW, const XSampling &xSampling, ShowerPositionArrayPair &positionMapsU, ShowerPositionArrayPair &positionMapsV,
+    ShowerPositionArrayPair &positionMapsW) const
 {
     const unsigned int nPoints(static_cast<unsigned int>(xSampling.m_nPoints));
+    const LArTransformationPlugin *const pTransformationPlugin(this->GetPandora().GetPlugins()->GetLArTransformationPlugin());
+
+    positionMapsU.first.Reset(nPoints + 2); positionMapsU.second.Reset(nPoints + 2);
+    positionMapsV.first.Reset(nPoints + 2); positionMapsV.second.Reset(nPoints + 2);
+    positionMapsW.first.Reset(nPoints + 2); positionMapsW.second.Reset(nPoints + 2);
+
+    // ATTN Shower edges are returned as an ordered (min, max) pair, or not at all
+    FloatVector uValues, vValues, wValues;
 
     for (unsigned n = 0; n <= nPoints; ++n)
     {
@@ -233,88 +259,85 @@ void ThreeDShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFitRes
         if (STATUS_CODE_SUCCESS != xSampling.GetBin(x, xBin))
             continue;
 
-        FloatVector uValues, vValues, wValues;
         fitResultU.GetShowerEdges(x, true, uValues);
         fitResultV.GetShowerEdges(x, true, vValues);
         fitResultW.GetShowerEdges(x, true, wValues);
 
-        std::sort(uValues.begin(), uValues.end());
-        std::sort(vValues.begin(), vValues.end());
-        std::sort(wValues.begin(), wValues.end());
-
         if ((uValues.size() > 1) && (vValues.size() > 1))
         {
             const float uMin(uValues.front()), uMax(uValues.back());
             const float vMin(vValues.front()), vMax(vValues.back());
-            const float uv2wMinMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMin, vMin));
-            const float uv2wMaxMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMax, vMax));
-            const float uv2wMinMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMin, vMax));
-            const float uv2wMaxMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMax, vMin));
-            positionMapsW.first.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uv2wMinMin, uv2wMaxMax)));
-            positionMapsW.second.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uv2wMinMax, uv2wMaxMin)));
+            const float uv2wMinMin(pTransformationPlugin->UVtoW(uMin, vMin));
+            const float uv2wMaxMax(pTransformationPlugin->UVtoW(uMax, vMax));
+            const float uv2wMinMax(pTransformationPlugin->UVtoW(uMin, vMax));
+            const float uv2wMaxMin(pTransformationPlugin->UVtoW(uMax, vMin));
+            positionMapsW.first.SetEdges(xBin, uv2wMinMin, uv2wMaxMax);
+            positionMapsW.second.SetEdges(xBin, uv2wMinMax, uv2wMaxMin);
         }
 
         if ((uValues.size() > 1) && (wValues.size() > 1))
         {
             const float uMin(uValues.front()), uMax(uValues.back());
             const float wMin(wValues.front()), wMax(wValues.back());
-            const float uw2vMinMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMin, wMin));
-            const float uw2vMaxMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMax, wMax));
-            const float uw2vMinMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMin, wMax));
-            const float uw2vMaxMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMax, wMin));
-            positionMapsV.first.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uw2vMinMin, uw2vMaxMax)));
-            positionMapsV.second.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uw2vMinMax, uw2vMaxMin)));
+            const float uw2vMinMin(pTransformationPlugin->WUtoV(wMin, uMin));
+            const float uw2vMaxMax(pTransformationPlugin->WUtoV(wMax, uMax));
+            const float uw2vMinMax(pTransformationPlugin->WUtoV(wMax, uMin));
+            const float uw2vMaxMin(pTransformationPlugin->WUtoV(wMin, uMax));
+            positionMapsV.first.SetEdges(xBin, uw2vMinMin, uw2vMaxMax);
+            positionMapsV.second.SetEdges(xBin, uw2vMinMax, uw2vMaxMin);
         }
 
         if ((vValues.size() > 1) && (wValues.size() > 1))
         {
             const float vMin(vValues.front()), vMax(vValues.back());
             const float wMin(wValues.front()), wMax(wValues.back());
-            const float vw2uMinMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMin, wMin));
-            const float vw2uMaxMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMax, wMax));
-            const float vw2uMinMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMin, wMax));
-            const float vw2uMaxMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMax, wMin));
-            positionMapsU.first.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, vw2uMinMin, vw2uMaxMax)));
-            positionMapsU.second.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, vw2uMinMax, vw2uMaxMin)));
+            const float vw2uMinMin(pTransformationPlugin->VWtoU(vMin, wMin));
+            const float vw2uMaxMax(pTransformationPlugin->VWtoU(vMax, wMax));
+            const float vw2uMinMax(pTransformationPlugin->VWtoU(vMin, wMax));
+            const float vw2uMaxMin(pTransformationPlugin->VWtoU(vMax, wMin));
+            positionMapsU.first.SetEdges(xBin, vw2uMinMin, vw2uMaxMax);
+            positionMapsU.second.SetEdges(xBin, vw2uMinMax, vw2uMaxMin);
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDShowersAlgorithm::GetBestHitOverlapFraction(const Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMapPair &positionMaps,
+void ThreeDShowersAlgorithm::GetBestHitOverlapFraction(const Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionArrayPair &positionMaps,
     unsigned int &nSampledHits, unsigned int &nMatchedHits) const
 {
     if ((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    HitCoordinateMap::const_iterator hitCoordinateIter = m_hitCoordinateMap.find(pCluster);
+
+    if (m_hitCoordinateMap.end() == hitCoordinateIter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
     nSampledHits = 0; nMatchedHits = 0;
     unsigned int nMatchedHits1(0), nMatchedHits2(0);
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+    const HitCoordinateVector &hitCoordinateVector(hitCoordinateIter->second);
 
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
-    {
-        for (CaloHitList::const_iterator hIter = iter->second->begin(), hIterEnd = iter->second->end(); hIter != hIterEnd; ++hIter)
-        {
-            const CaloHit *const pCaloHit = *hIter;
-            const float x(pCaloHit->GetPositionVector().GetX());
-            const float z(pCaloHit->GetPositionVector().GetZ());
+    // ATTN Hits are sorted by x, so only those within the common x-overlap range are visited
+    HitCoordinateVector::const_iterator iter = std::partition_point(hitCoordinateVector.begin(), hitCoordinateVector.end(),
+        [&xSampling](const HitCoordinateVector::value_type &hitCoordinate) { return ((hitCoordinate.first - xSampling.m_minX) < -std::numeric_limits<float>::epsilon()); });
 
-            int xBin(-1);
-            if (STATUS_CODE_SUCCESS != xSampling.GetBin(x, xBin))
-                continue;
+    for (HitCoordinateVector::const_iterator iterEnd = hitCoordinateVector.end(); iter != iterEnd; ++iter)
+    {
+        const float x(iter->first);
+        const float z(iter->second);
 
-            ++nSampledHits;
+        int xBin(-1);
+        if (STATUS_CODE_SUCCESS != xSampling.GetBin(x, xBin))
+            break;
 
-            ShowerPositionMap::const_iterator positionIter1 = positionMaps.first.find(xBin);
-            ShowerPositionMap::const_iterator positionIter2 = positionMaps.second.find(xBin);
+        ++nSampledHits;
 
-            if ((positionMaps.first.end() != positionIter1) && (z > positionIter1->second.GetLowEdgeZ()) && (z < positionIter1->second.GetHighEdgeZ()))
-                ++nMatchedHits1;
+        if (positionMaps.first.IsContained(xBin, z))
+            ++nMatchedHits1;
 
-            if ((positionMaps.second.end() != positionIter2) && (z > positionIter2->second.GetLowEdgeZ()) && (z < positionIter2->second.GetHighEdgeZ()))
-                ++nMatchedHits2;
-        }
+        if (positionMaps.second.IsContained(xBin, z))
+            ++nMatchedHits2;
     }
 
     nMatchedHits = std::max(nMatchedHits1, nMatchedHits2);
@@ -328,6 +351,8 @@ void ThreeDShowersAlgorithm::ExamineTensor()
 
     for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd; )
     {
+        const LArProfilingHelper::ScopedTimer scopedTimer(*iter);
+
         if ((*iter)->Run(this, m_overlapTensor))
         {
             iter = m_algorithmToolVector.begin();
@@ -379,6 +404,48 @@ StatusCode ThreeDShowersAlgorithm::XSampling::GetBin(const float x, int &xBin) c
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeDShowersAlgorithm::ShowerPositionArray::Reset(const unsigned int nBins)
+{
+    // ATTN Unset bins have inverted edges, so contain no z coordinates
+    m_lowEdgeZ.assign(nBins, std::numeric_limits<float>::max());
+    m_highEdgeZ.assign(nBins, -std::numeric_limits<float>::max());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeDShowersAlgorithm::ShowerPositionArray::SetEdges(const int xBin, const float edge1, const float edge2)
+{
+    if (xBin < 0)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const unsigned int bin(static_cast<unsigned int>(xBin));
+
+    if (bin >= m_lowEdgeZ.size())
+    {
+        m_lowEdgeZ.resize(bin + 1, std::numeric_limits<float>::max());
+        m_highEdgeZ.resize(bin + 1, -std::numeric_limits<float>::max());
+    }
+
+    if (m_lowEdgeZ.at(bin) > m_highEdgeZ.at(bin))
+    {
+        m_lowEdgeZ.at(bin) = std::min(edge1, edge2);
+        m_highEdgeZ.at(bin) = std::max(edge1, edge2);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreeDShowersAlgorithm::ShowerPositionArray::IsContained(const int xBin, const float z) const
+{
+    if ((xBin < 0) || (static_cast<unsigned int>(xBin) >= m_lowEdgeZ.size()))
+        return false;
+
+    return ((z > m_lowEdgeZ[xBin]) && (z < m_highEdgeZ[xBin]));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDShowersAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     AlgorithmToolVector algorithmToolVector;
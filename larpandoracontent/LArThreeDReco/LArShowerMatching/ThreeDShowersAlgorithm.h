@@ -83,6 +83,47 @@ private:
         float       m_nPoints;       ///< The number of sampling points to be used
     };
 
+    /**
+     *  @brief  ShowerPositionArray class, the shower edge positions for a set of x sampling bins, stored contiguously by bin
+     */
+    class ShowerPositionArray
+    {
+    public:
+        /**
+         *  @brief  Clear the array, reserving space for a specified number of x bins
+         *
+         *  @param  nBins the number of x bins
+         */
+        void Reset(const unsigned int nBins);
+
+        /**
+         *  @brief  Set the shower edges for an x bin, if not already set
+         *
+         *  @param  xBin the x bin
+         *  @param  edge1 the first shower edge z coordinate
+         *  @param  edge2 the second shower edge z coordinate
+         */
+        void SetEdges(const int xBin, const float edge1, const float edge2);
+
+        /**
+         *  @brief  Whether a z coordinate lies strictly between the shower edges for an x bin
+         *
+         *  @param  xBin the x bin
+         *  @param  z the z coordinate
+         *
+         *  @return boolean
+         */
+        bool IsContained(const int xBin, const float z) const;
+
+    private:
+        pandora::FloatVector    m_lowEdgeZ;     ///< The shower low edge z coordinate for each x bin
+        pandora::FloatVector    m_highEdgeZ;    ///< The shower high edge z coordinate for each x bin
+    };
+
+    typedef std::pair<ShowerPositionArray, ShowerPositionArray> ShowerPositionArrayPair;
+    typedef std::vector<std::pair<float, float> > HitCoordinateVector;
+    typedef std::unordered_map<const pandora::Cluster*, HitCoordinateVector> HitCoordinateMap;
+
     void PreparationStep();
 
     /**
@@ -95,14 +136,14 @@ private:
     void TidyUp();
 
     /**
-     *  @brief  Add a new sliding fit result, for the specified cluster, to the algorithm cache
+     *  @brief  Add a new sliding fit result, and the hit coordinates, for the specified cluster, to the algorithm cache
      * 
      *  @param  pCluster address of the relevant cluster
      */
     void AddToSlidingFitCache(const pandora::Cluster *const pCluster);
 
     /**
-     *  @brief  Remova an existing sliding fit result, for the specified cluster, from the algorithm cache
+     *  @brief  Remova an existing sliding fit result, and the hit coordinates, for the specified cluster, from the algorithm cache
      * 
      *  @param  pCluster address of the relevant cluster
      */
@@ -121,10 +162,8 @@ private:
     pandora::StatusCode CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW,
         ShowerOverlapResult &overlapResult);
 
-    typedef std::pair<ShowerPositionMap, ShowerPositionMap> ShowerPositionMapPair;
-
     /**
-     *  @brief  Get the shower position maps
+     *  @brief  Get the shower position maps, stored as arrays indexed by x bin
      * 
      *  @param  fitResultU the sliding shower fit result for the u view
      *  @param  fitResultV the sliding shower fit result for the v view
@@ -135,7 +174,7 @@ private:
      *  @param  positionMapsW to receive the shower position maps for the w view
      */
     void GetShowerPositionMaps(const TwoDSlidingShowerFitResult &fitResultU, const TwoDSlidingShowerFitResult &fitResultV, const TwoDSlidingShowerFitResult &fitResultW,
-        const XSampling &xSampling, ShowerPositionMapPair &positionMapsU, ShowerPositionMapPair &positionMapsV, ShowerPositionMapPair &positionMapsW) const;
+        const XSampling &xSampling, ShowerPositionArrayPair &positionMapsU, ShowerPositionArrayPair &positionMapsV, ShowerPositionArrayPair &positionMapsW) const;
 
     /**
      *  @brief  Get the best fraction of hits, in the common x-overlap range, contained within the provided pair of shower boundaries
@@ -146,7 +185,7 @@ private:
      *  @param  nSampledHits to receive the number of hits in the common x-overlap range
      *  @param  nMatchedHits to receive the number of sampled hits contained within the shower edges
      */
-    void GetBestHitOverlapFraction(const pandora::Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMapPair &positionMaps,
+    void GetBestHitOverlapFraction(const pandora::Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionArrayPair &positionMaps,
         unsigned int &nSampledHits, unsigned int &nMatchedHits) const;
 
     void ExamineTensor();
@@ -158,6 +197,7 @@ private:
 
     unsigned int                    m_slidingFitWindow;             ///< The layer window for the sliding linear fits
     TwoDSlidingShowerFitResultMap   m_slidingFitResultMap;          ///< The sliding shower fit result map
+    HitCoordinateMap                m_hitCoordinateMap;             ///< The hit (x, z) coordinates for each cached cluster, sorted by x
 
     bool                            m_ignoreUnavailableClusters;    ///< Whether to ignore (skip-over) unavailable clusters
     unsigned int                    m_minClusterCaloHits;           ///< The min number of hits in base cluster selection method
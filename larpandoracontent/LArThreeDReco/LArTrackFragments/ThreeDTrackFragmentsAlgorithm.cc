@@ -10,9 +10,12 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArTrackFragments/ThreeDTrackFragmentsAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 using namespace pandora;
 
 namespace lar_content
@@ -32,6 +35,8 @@ ThreeDTrackFragmentsAlgorithm::ThreeDTrackFragmentsAlgorithm() :
 
 void ThreeDTrackFragmentsAlgorithm::UpdateForNewCluster(const Cluster *const pNewCluster)
 {
+    this->InvalidateHitIndex(pNewCluster);
+
     try
     {
         this->AddToSlidingFitCache(pNewCluster);
@@ -99,6 +104,14 @@ void ThreeDTrackFragmentsAlgorithm::UpdateForNewCluster(const Cluster *const pNe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeDTrackFragmentsAlgorithm::UpdateUponDeletion(const Cluster *const pDeletedCluster)
+{
+    this->InvalidateHitIndex(pDeletedCluster);
+    ThreeDTracksBaseAlgorithm<FragmentOverlapResult>::UpdateUponDeletion(pDeletedCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeDTrackFragmentsAlgorithm::RebuildClusters(const ClusterList &rebuildList, ClusterList &newClusters) const
 {
     const ClusterList *pNewClusterList = NULL;
@@ -409,32 +422,32 @@ StatusCode ThreeDTrackFragmentsAlgorithm::GetProjectedPositions(const TwoDSlidin
 StatusCode ThreeDTrackFragmentsAlgorithm::GetMatchedHits(const ClusterList &inputClusterList, const CartesianPointVector &projectedPositions,
     HitToClusterMap &hitToClusterMap, CaloHitList &matchedHits) const
 {
-    CaloHitVector availableCaloHits;
+    const HitIndex &hitIndex(this->GetHitIndex(inputClusterList));
 
-    for (ClusterList::const_iterator iter = inputClusterList.begin(), iterEnd = inputClusterList.end(); iter != iterEnd; ++iter)
-    {
-        const Cluster *const pCluster = *iter;
+    if (!hitIndex.m_pKDTree)
+        return STATUS_CODE_NOT_FOUND;
 
-        if (!pCluster->IsAvailable())
-            continue;
+    // ATTN Search beyond the maximum displacement, then examine nearby hits in position order, so the closest hit and tie-breaks are unchanged
+    const float searchDistance(1.01f * std::sqrt(m_maxPointDisplacementSquared) + 0.1f);
+    CaloHitSet matchedHitSet;
 
-        CaloHitList caloHitList;
-        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
-        availableCaloHits.insert(availableCaloHits.end(), caloHitList.begin(), caloHitList.end());
+    for (const CartesianVector &projectedPosition : projectedPositions)
+    {
+        HitKDNode2DList foundHits;
+        hitIndex.m_pKDTree->search(build_2d_kd_search_region(projectedPosition, searchDistance, searchDistance), foundHits);
 
-        for (CaloHitList::const_iterator hIter = caloHitList.begin(), hIterEnd = caloHitList.end(); hIter != hIterEnd; ++hIter)
-            hitToClusterMap.insert(HitToClusterMap::value_type(*hIter, pCluster));
-    }
+        std::vector<std::pair<unsigned int, const CaloHit*> > nearbyCaloHits;
+        for (const HitKDNode2D &hitKDNode2D : foundHits)
+            nearbyCaloHits.push_back(std::make_pair(hitIndex.m_hitToIndexMap.at(hitKDNode2D.data), hitKDNode2D.data));
 
-    std::sort(availableCaloHits.begin(), availableCaloHits.end(), LArClusterHelper::SortHitsByPosition);
+        std::sort(nearbyCaloHits.begin(), nearbyCaloHits.end());
 
-    for (const CartesianVector &projectedPosition : projectedPositions)
-    {
         const CaloHit *pClosestCaloHit(NULL);
         float closestDistanceSquared(std::numeric_limits<float>::max()), tieBreakerBestEnergy(0.f);
 
-        for (const CaloHit *const pCaloHit : availableCaloHits)
+        for (const auto &nearbyCaloHit : nearbyCaloHits)
         {
+            const CaloHit *const pCaloHit(nearbyCaloHit.second);
             const float distanceSquared((pCaloHit->GetPositionVector() - projectedPosition).GetMagnitudeSquared());
 
             if ((distanceSquared < closestDistanceSquared) || ((std::fabs(distanceSquared - closestDistanceSquared) < std::numeric_limits<float>::epsilon()) && (pCaloHit->GetHadronicEnergy() > tieBreakerBestEnergy)))
@@ -445,8 +458,11 @@ StatusCode ThreeDTrackFragmentsAlgorithm::GetMatchedHits(const ClusterList &inpu
             }
         }
 
-        if ((closestDistanceSquared < m_maxPointDisplacementSquared) && (NULL != pClosestCaloHit) && (matchedHits.end() == std::find(matchedHits.begin(), matchedHits.end(), pClosestCaloHit)))
+        if ((closestDistanceSquared < m_maxPointDisplacementSquared) && (NULL != pClosestCaloHit) && matchedHitSet.insert(pClosestCaloHit).second)
+        {
             matchedHits.push_back(pClosestCaloHit);
+            hitToClusterMap.insert(HitToClusterMap::value_type(pClosestCaloHit, hitIndex.m_hitToClusterMap.at(pClosestCaloHit)));
+        }
     }
 
     if (matchedHits.empty())
@@ -457,6 +473,76 @@ StatusCode ThreeDTrackFragmentsAlgorithm::GetMatchedHits(const ClusterList &inpu
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const ThreeDTrackFragmentsAlgorithm::HitIndex &ThreeDTrackFragmentsAlgorithm::GetHitIndex(const ClusterList &inputClusterList) const
+{
+    HitIndex &hitIndex(m_hitIndexMap[&inputClusterList]);
+
+    // ATTN Cluster availability can change without notification, e.g. when particles are created, so also compare the available clusters
+    ClusterSignature clusterSignature;
+
+    for (const Cluster *const pCluster : inputClusterList)
+    {
+        if (pCluster->IsAvailable())
+            clusterSignature.push_back(ClusterSignature::value_type(pCluster, pCluster->GetNCaloHits()));
+    }
+
+    if (hitIndex.m_isValid && (clusterSignature == hitIndex.m_clusterSignature))
+        return hitIndex;
+
+    hitIndex.Clear();
+    hitIndex.m_clusterSignature = clusterSignature;
+
+    CaloHitVector availableCaloHits;
+
+    for (const ClusterSignature::value_type &signatureEntry : clusterSignature)
+    {
+        const Cluster *const pCluster(signatureEntry.first);
+
+        CaloHitList caloHitList;
+        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+        availableCaloHits.insert(availableCaloHits.end(), caloHitList.begin(), caloHitList.end());
+
+        for (const CaloHit *const pCaloHit : caloHitList)
+            hitIndex.m_hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster));
+
+        if (HIT_CUSTOM == hitIndex.m_hitType)
+            hitIndex.m_hitType = LArClusterHelper::GetClusterHitType(pCluster);
+    }
+
+    std::sort(availableCaloHits.begin(), availableCaloHits.end(), LArClusterHelper::SortHitsByPosition);
+
+    for (unsigned int hitIndexPosition = 0; hitIndexPosition < availableCaloHits.size(); ++hitIndexPosition)
+        hitIndex.m_hitToIndexMap.insert(HitToIndexMap::value_type(availableCaloHits.at(hitIndexPosition), hitIndexPosition));
+
+    if (!availableCaloHits.empty())
+    {
+        const CaloHitList availableCaloHitList(availableCaloHits.begin(), availableCaloHits.end());
+        HitKDNode2DList hitKDNode2DList;
+        KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(availableCaloHitList, hitKDNode2DList));
+
+        hitIndex.m_pKDTree = new HitKDTree2D;
+        hitIndex.m_pKDTree->build(hitKDNode2DList, hitsBoundingRegion2D);
+    }
+
+    hitIndex.m_isValid = true;
+    return hitIndex;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeDTrackFragmentsAlgorithm::InvalidateHitIndex(const Cluster *const pCluster)
+{
+    const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
+
+    for (HitIndexMap::value_type &mapEntry : m_hitIndexMap)
+    {
+        if ((HIT_CUSTOM == mapEntry.second.m_hitType) || (hitType == mapEntry.second.m_hitType))
+            mapEntry.second.m_isValid = false;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDTrackFragmentsAlgorithm::GetMatchedClusters(const CaloHitList &matchedHits, const HitToClusterMap &hitToClusterMap,
     ClusterList &matchedClusters, const Cluster *&pBestMatchedCluster) const
 {
@@ -615,6 +701,8 @@ void ThreeDTrackFragmentsAlgorithm::ExamineTensor()
 
     for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd; )
     {
+        const LArProfilingHelper::ScopedTimer scopedTimer(*iter);
+
         if ((*iter)->Run(this, m_overlapTensor))
         {
             iter = m_algorithmToolVector.begin();
@@ -631,6 +719,45 @@ void ThreeDTrackFragmentsAlgorithm::ExamineTensor()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeDTrackFragmentsAlgorithm::TidyUp()
+{
+    m_hitIndexMap.clear();
+    return ThreeDTracksBaseAlgorithm<FragmentOverlapResult>::TidyUp();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ThreeDTrackFragmentsAlgorithm::HitIndex::HitIndex() :
+    m_isValid(false),
+    m_hitType(HIT_CUSTOM),
+    m_pKDTree(NULL)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ThreeDTrackFragmentsAlgorithm::HitIndex::~HitIndex()
+{
+    delete m_pKDTree;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeDTrackFragmentsAlgorithm::HitIndex::Clear()
+{
+    delete m_pKDTree;
+    m_pKDTree = NULL;
+
+    m_isValid = false;
+    m_hitType = HIT_CUSTOM;
+    m_clusterSignature.clear();
+    m_hitToClusterMap.clear();
+    m_hitToIndexMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDTrackFragmentsAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithm(*this, xmlHandle,
@@ -22,6 +22,9 @@ namespace lar_content
 
 class FragmentTensorTool;
 
+template<typename, unsigned int> class KDTreeLinkerAlgo;
+template<typename, unsigned int> class KDTreeNodeInfoT;
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -36,6 +39,7 @@ public:
     ThreeDTrackFragmentsAlgorithm();
 
     void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
+    void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
 
     /**
      *  @brief  Rebuild clusters after fragmentation
@@ -64,6 +68,53 @@ protected:
         const pandora::ClusterList &inputClusterList, const pandora::Cluster *&pBestMatchedCluster, FragmentOverlapResult &fragmentOverlapResult) const;
 
     typedef std::unordered_map<const pandora::CaloHit*, const pandora::Cluster*> HitToClusterMap;
+    typedef std::unordered_map<const pandora::CaloHit*, unsigned int> HitToIndexMap;
+    typedef std::vector<std::pair<const pandora::Cluster*, unsigned int> > ClusterSignature;
+
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit*, 2> HitKDTree2D;
+    typedef KDTreeNodeInfoT<const pandora::CaloHit*, 2> HitKDNode2D;
+    typedef std::vector<HitKDNode2D> HitKDNode2DList;
+
+    /**
+     *  @brief  HitIndex class, a nearest-neighbour index of the hits in the available clusters of an input cluster list
+     */
+    class HitIndex
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        HitIndex();
+
+        /**
+         *  @brief  Destructor
+         */
+        ~HitIndex();
+
+        /**
+         *  @brief  Deleted copy constructor, as the index owns its kd tree; indices are constructed in place in the hit index map
+         */
+        HitIndex(const HitIndex &) = delete;
+
+        /**
+         *  @brief  Deleted assignment operator
+         */
+        HitIndex &operator=(const HitIndex &) = delete;
+
+        /**
+         *  @brief  Clear the index
+         */
+        void Clear();
+
+        bool                    m_isValid;              ///< Whether the index is believed to be up-to-date with its input cluster list
+        pandora::HitType        m_hitType;              ///< The hit type of the indexed clusters
+        ClusterSignature        m_clusterSignature;     ///< The indexed clusters and their numbers of hits, in input list order
+        HitKDTree2D            *m_pKDTree;              ///< The kd tree of indexed hits
+        HitToClusterMap         m_hitToClusterMap;      ///< The map from indexed hits to their parent clusters
+        HitToIndexMap           m_hitToIndexMap;        ///< The position of each indexed hit when all indexed hits are sorted by position
+    };
+
+    typedef std::unordered_map<const pandora::ClusterList*, HitIndex> HitIndexMap;
 
     /**
      *  @brief  Get the list of projected positions, in the third view, corresponding to a pair of sliding fit results
@@ -82,7 +133,7 @@ protected:
      *
      *  @param  inputClusterList the input cluster list
      *  @param  projectedPositions the list of projected positions
-     *  @param  hitToClusterMap to receive the hit to cluster map
+     *  @param  hitToClusterMap to receive the hit to cluster map for the associated calo hits
      *  @param  matchedCaloHits to receive the list of associated calo hits
      * 
      *  @return statusCode, faster than throwing in regular use-cases
@@ -90,6 +141,22 @@ protected:
     pandora::StatusCode GetMatchedHits(const pandora::ClusterList &inputClusterList, const pandora::CartesianPointVector &projectedPositions,
         HitToClusterMap &hitToClusterMap, pandora::CaloHitList &matchedCaloHits) const;
 
+    /**
+     *  @brief  Get the hit index for an input cluster list, rebuilding it if the available clusters have changed
+     *
+     *  @param  inputClusterList the input cluster list
+     *
+     *  @return the hit index
+     */
+    const HitIndex &GetHitIndex(const pandora::ClusterList &inputClusterList) const;
+
+    /**
+     *  @brief  Mark the hit index for the view of a new or deleted cluster as out of date
+     *
+     *  @param  pCluster the address of the new or deleted cluster
+     */
+    void InvalidateHitIndex(const pandora::Cluster *const pCluster);
+
     /**
      *  @brief  Get the list of the relevant clusters and the address of the single best matched cluster
      *
@@ -134,6 +201,7 @@ protected:
     bool CheckOverlapResult(const FragmentOverlapResult &overlapResult) const;
 
     void ExamineTensor();
+    void TidyUp();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::unordered_map<const pandora::Cluster*, unsigned int> ClusterToMatchedHitsMap;
@@ -150,6 +218,8 @@ protected:
     float               m_maxPointDisplacementSquared;      ///< maximum allowed distance (squared) between projected points and associated hits
     float               m_minMatchedSamplingPointFraction;  ///< minimum fraction of matched sampling points
     unsigned int        m_minMatchedHits;                   ///< minimum number of matched calo hits
+
+    mutable HitIndexMap m_hitIndexMap;                      ///< The hit indices for the input cluster lists, persisting across overlap calculations
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -27,7 +27,8 @@ TracksCrossingGapsTool::TracksCrossingGapsTool() :
     m_minMatchedSamplingPointRatio(2),
     m_maxGapTolerance(2.f),
     m_sampleStepSize(0.5f),
-    m_maxAngleRatio(2)
+    m_maxAngleRatio(2),
+    m_detectorGapIndex(DetectorGapList())
 {
 }
 
@@ -38,9 +39,13 @@ bool TracksCrossingGapsTool::Run(ThreeDTransverseTracksAlgorithm *const pAlgorit
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
-    if (PandoraContentApi::GetGeometry(*pAlgorithm)->GetDetectorGapList().empty())
+    const DetectorGapList &detectorGapList(PandoraContentApi::GetGeometry(*pAlgorithm)->GetDetectorGapList());
+
+    if (detectorGapList.empty())
         return false;
 
+    m_detectorGapIndex = LArGeometryHelper::DetectorGapIndex(detectorGapList);
+
     ProtoParticleVector protoParticleVector;
     this->FindTracks(pAlgorithm, overlapTensor, protoParticleVector);
 
@@ -244,11 +249,11 @@ bool TracksCrossingGapsTool::CheckXPositionInGap(const float xSample, const TwoD
 
         const float zSample(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), hitType2, hitType3, fitPosition2.GetZ(), fitPosition3.GetZ()));
         const CartesianVector samplingPoint(xSample, 0.f, zSample);
-        return LArGeometryHelper::IsInGap(this->GetPandora(), CartesianVector(xSample, 0.f, zSample), hitType1, m_maxGapTolerance);
+        return m_detectorGapIndex.IsInGap(CartesianVector(xSample, 0.f, zSample), hitType1, m_maxGapTolerance);
     }
 
     // ATTN Only safe to return here (for efficiency) because gapIn2 and gapIn3 values aren't used by calling function if we return false
-    gapIn1 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult1, m_sampleStepSize);
+    gapIn1 = LArGeometryHelper::IsXSamplingPointInGap(m_detectorGapIndex, xSample, slidingFitResult1, m_sampleStepSize);
 
     if (!gapIn1)
         return false;
@@ -261,10 +266,10 @@ bool TracksCrossingGapsTool::CheckXPositionInGap(const float xSample, const TwoD
         const bool endIn3(this->IsEndOfCluster(xSample, slidingFitResult3));
 
         if (!endIn2)
-            gapIn2 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult2, m_sampleStepSize);
+            gapIn2 = LArGeometryHelper::IsXSamplingPointInGap(m_detectorGapIndex, xSample, slidingFitResult2, m_sampleStepSize);
 
         if (!endIn3)
-            gapIn3 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult3, m_sampleStepSize);
+            gapIn3 = LArGeometryHelper::IsXSamplingPointInGap(m_detectorGapIndex, xSample, slidingFitResult3, m_sampleStepSize);
 
         return ((gapIn2 && endIn3) || (gapIn3 && endIn2) || (endIn2 && endIn3));
     }
@@ -272,12 +277,12 @@ bool TracksCrossingGapsTool::CheckXPositionInGap(const float xSample, const TwoD
     // Finally, check whether there is a second gap involved
     if (STATUS_CODE_SUCCESS != slidingFitResult2.GetGlobalFitPositionAtX(xSample, fitPosition2))
     {
-        gapIn2 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult2, m_sampleStepSize);
+        gapIn2 = LArGeometryHelper::IsXSamplingPointInGap(m_detectorGapIndex, xSample, slidingFitResult2, m_sampleStepSize);
         return (gapIn2 || this->IsEndOfCluster(xSample, slidingFitResult2));
     }
     else
     {
-        gapIn3 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult3, m_sampleStepSize);
+        gapIn3 = LArGeometryHelper::IsXSamplingPointInGap(m_detectorGapIndex, xSample, slidingFitResult3, m_sampleStepSize);
         return (gapIn3 || this->IsEndOfCluster(xSample, slidingFitResult3));
     }
 }
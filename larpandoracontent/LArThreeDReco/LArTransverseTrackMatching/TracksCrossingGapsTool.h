@@ -8,6 +8,8 @@
 #ifndef TRACKS_CROSSING_GAPS_TOOL_H
 #define TRACKS_CROSSING_GAPS_TOOL_H 1
 
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
 #include "larpandoracontent/LArThreeDReco/LArTransverseTrackMatching/ThreeDTransverseTracksAlgorithm.h"
 
@@ -125,6 +127,8 @@ private:
     float           m_maxGapTolerance;                  ///< The max gap tolerance
     float           m_sampleStepSize;                   ///< The sampling step size used in association checks, units cm
     unsigned int    m_maxAngleRatio;                    ///< The max ratio allowed in the angle
+
+    LArGeometryHelper::DetectorGapIndex m_detectorGapIndex; ///< The index of the detector gaps, rebuilt from the gap list for each run
 };
 
 } // namespace lar_content
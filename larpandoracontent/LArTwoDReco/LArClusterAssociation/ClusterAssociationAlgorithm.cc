@@ -19,7 +19,8 @@ namespace lar_content
 
 ClusterAssociationAlgorithm::ClusterAssociationAlgorithm() :
     m_mergeMade(false),
-    m_resolveAmbiguousAssociations(true)
+    m_resolveAmbiguousAssociations(true),
+    m_worklistPropagation(true)
 {
 }
 
@@ -37,23 +38,32 @@ StatusCode ClusterAssociationAlgorithm::Run()
     this->PopulateClusterAssociationMap(clusterVector, clusterAssociationMap);
 
     m_mergeMade = true;
+    m_deletedClusters.clear();
+    m_modifiedClusters.clear();
+
+    ClusterIndexMap clusterIndexMap;
+    ClusterIndexSet pendingIndices;
+
+    if (m_worklistPropagation)
+    {
+        for (unsigned int index = 0; index < clusterVector.size(); ++index)
+        {
+            (void) clusterIndexMap.insert(ClusterIndexMap::value_type(clusterVector.at(index), index));
+            (void) pendingIndices.insert(index);
+        }
+    }
 
     while (m_mergeMade)
     {
         // Unambiguous propagation
-        while (m_mergeMade)
+        if (m_worklistPropagation)
         {
+            this->WorklistUnambiguousPropagation(clusterVector, clusterIndexMap, clusterAssociationMap, pendingIndices);
             m_mergeMade = false;
-
-            for (const Cluster *const pCluster : clusterVector)
-            {
-                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against managed cluster list
-                if (pClusterList->end() == std::find(pClusterList->begin(), pClusterList->end(), pCluster))
-                    continue;
-
-                this->UnambiguousPropagation(pCluster, true,  clusterAssociationMap);
-                this->UnambiguousPropagation(pCluster, false, clusterAssociationMap);
-            }
+        }
+        else
+        {
+            this->SweepUnambiguousPropagation(clusterVector, clusterAssociationMap);
         }
 
         if (!m_resolveAmbiguousAssociations)
@@ -74,13 +84,115 @@ StatusCode ClusterAssociationAlgorithm::Run()
             if (mapIter->second.m_forwardAssociations.empty() && !mapIter->second.m_backwardAssociations.empty())
                 this->AmbiguousPropagation(pCluster, false, clusterAssociationMap);
         }
+
+        if (m_worklistPropagation)
+        {
+            ClusterSet affectedClusters;
+            this->GetAffectedClusters(clusterAssociationMap, affectedClusters);
+
+            for (const Cluster *const pAffectedCluster : affectedClusters)
+            {
+                ClusterIndexMap::const_iterator indexIter = clusterIndexMap.find(pAffectedCluster);
+
+                if (clusterIndexMap.end() != indexIter)
+                    (void) pendingIndices.insert(indexIter->second);
+            }
+        }
     }
 
+    m_deletedClusters.clear();
+    m_modifiedClusters.clear();
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ClusterAssociationAlgorithm::SweepUnambiguousPropagation(const ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const
+{
+    while (m_mergeMade)
+    {
+        m_mergeMade = false;
+
+        for (const Cluster *const pCluster : clusterVector)
+        {
+            // ATTN The clusterVector may end up with dangling pointers; only protected by this check against the deleted cluster set
+            if (m_deletedClusters.count(pCluster))
+                continue;
+
+            this->UnambiguousPropagation(pCluster, true,  clusterAssociationMap);
+            this->UnambiguousPropagation(pCluster, false, clusterAssociationMap);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterAssociationAlgorithm::WorklistUnambiguousPropagation(const ClusterVector &clusterVector, const ClusterIndexMap &clusterIndexMap,
+    ClusterAssociationMap &clusterAssociationMap, ClusterIndexSet &pendingIndices) const
+{
+    // ATTN Each pass mirrors one full sweep: clusters affected by a merge are revisited later in the same pass if they lie ahead of the
+    // current cluster in the cluster vector, otherwise in the next pass. Clusters that are not revisited cannot have become mergeable.
+    while (!pendingIndices.empty())
+    {
+        ClusterIndexSet passIndices;
+        passIndices.swap(pendingIndices);
+
+        for (ClusterIndexSet::const_iterator iter = passIndices.begin(); iter != passIndices.end(); ++iter)
+        {
+            const unsigned int index(*iter);
+            const Cluster *const pCluster(clusterVector.at(index));
+
+            if (m_deletedClusters.count(pCluster))
+                continue;
+
+            this->UnambiguousPropagation(pCluster, true,  clusterAssociationMap);
+            this->UnambiguousPropagation(pCluster, false, clusterAssociationMap);
+
+            ClusterSet affectedClusters;
+            this->GetAffectedClusters(clusterAssociationMap, affectedClusters);
+
+            for (const Cluster *const pAffectedCluster : affectedClusters)
+            {
+                ClusterIndexMap::const_iterator indexIter = clusterIndexMap.find(pAffectedCluster);
+
+                if (clusterIndexMap.end() == indexIter)
+                    continue;
+
+                if (indexIter->second > index)
+                {
+                    (void) passIndices.insert(indexIter->second);
+                }
+                else
+                {
+                    (void) pendingIndices.insert(indexIter->second);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterAssociationAlgorithm::GetAffectedClusters(const ClusterAssociationMap &clusterAssociationMap, ClusterSet &affectedClusters) const
+{
+    for (const Cluster *const pModifiedCluster : m_modifiedClusters)
+    {
+        ClusterAssociationMap::const_iterator mapIter = clusterAssociationMap.find(pModifiedCluster);
+
+        if (clusterAssociationMap.end() == mapIter)
+            continue;
+
+        (void) affectedClusters.insert(pModifiedCluster);
+        affectedClusters.insert(mapIter->second.m_forwardAssociations.begin(), mapIter->second.m_forwardAssociations.end());
+        affectedClusters.insert(mapIter->second.m_backwardAssociations.begin(), mapIter->second.m_backwardAssociations.end());
+    }
+
+    m_modifiedClusters.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const
 {
     const Cluster *const pClusterToEnlarge = pCluster;
@@ -107,6 +219,7 @@ void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pC
 
     this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForward, clusterAssociationMap);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pClusterToEnlarge, pClusterToDelete));
+    (void) m_deletedClusters.insert(pClusterToDelete);
     m_mergeMade = true;
 
     this->UnambiguousPropagation(pClusterToEnlarge, isForward, clusterAssociationMap);
@@ -149,6 +262,7 @@ void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pClu
     {
         this->UpdateForAmbiguousMerge(pCluster, *dIter, isForward, clusterAssociationMap);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pCluster, *dIter));
+        (void) m_deletedClusters.insert(*dIter);
         m_mergeMade = true;
         *dIter = NULL;
     } 
@@ -169,6 +283,7 @@ void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const
     ClusterSet &clusterSetToReplace(isForwardMerge ? iterEnlarge->second.m_forwardAssociations : iterEnlarge->second.m_backwardAssociations);
     clusterSetToReplace = clusterSetToMove;
     clusterAssociationMap.erase(iterDelete);
+    (void) m_modifiedClusters.insert(pClusterToEnlarge);
 
     for (ClusterAssociationMap::iterator iter = clusterAssociationMap.begin(), iterEnd = clusterAssociationMap.end(); iter != iterEnd; ++iter)
     {
@@ -182,12 +297,14 @@ void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const
         {
             forwardClusters.erase(forwardIter);
             forwardClusters.insert(pClusterToEnlarge);
+            (void) m_modifiedClusters.insert(iter->first);
         }
 
         if (backwardClusters.end() != backwardIter)
         {
             backwardClusters.erase(backwardIter);
             backwardClusters.insert(pClusterToEnlarge);
+            (void) m_modifiedClusters.insert(iter->first);
         }
     }
 }
@@ -223,6 +340,7 @@ void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const p
                 throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
             associatedClusterSet.erase(enlargeIter);
+            (void) m_modifiedClusters.insert(iterAssociation->first);
             clusterSetEnlarge.erase(iter++);
         }
         else
@@ -248,6 +366,7 @@ void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const p
                 throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
             associatedClusterSet.erase(deleteIter);
+            (void) m_modifiedClusters.insert(iterAssociation->first);
             clusterSetDelete.erase(iter++);
         }
         else
@@ -289,6 +408,9 @@ StatusCode ClusterAssociationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "ResolveAmbiguousAssociations", m_resolveAmbiguousAssociations));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "WorklistPropagation", m_worklistPropagation));
+
     return STATUS_CODE_SUCCESS;
 }
 
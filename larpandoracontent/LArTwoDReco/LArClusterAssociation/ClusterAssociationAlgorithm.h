@@ -10,6 +10,7 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <set>
 #include <unordered_map>
 
 namespace lar_content
@@ -70,6 +71,37 @@ protected:
     virtual bool IsExtremalCluster(const bool isForward, const pandora::Cluster *const pCurrentCluster, const pandora::Cluster *const pTestCluster) const = 0;
 
 private:
+    typedef std::set<unsigned int> ClusterIndexSet;
+    typedef std::unordered_map<const pandora::Cluster*, unsigned int> ClusterIndexMap;
+
+    /**
+     *  @brief  Unambiguous propagation, repeatedly sweeping over the full cluster vector until no further merges are made
+     * 
+     *  @param  clusterVector the cluster vector
+     *  @param  clusterAssociationMap the cluster association map
+     */
+    void SweepUnambiguousPropagation(const pandora::ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const;
+
+    /**
+     *  @brief  Unambiguous propagation, visiting only those clusters whose associations may have changed since they were last visited.
+     *          Clusters are visited in the same order as for the full sweeps, so the same merges are made.
+     * 
+     *  @param  clusterVector the cluster vector
+     *  @param  clusterIndexMap the map from cluster to position in the cluster vector
+     *  @param  clusterAssociationMap the cluster association map
+     *  @param  pendingIndices the indices of the clusters to visit, emptied on return
+     */
+    void WorklistUnambiguousPropagation(const pandora::ClusterVector &clusterVector, const ClusterIndexMap &clusterIndexMap,
+        ClusterAssociationMap &clusterAssociationMap, ClusterIndexSet &pendingIndices) const;
+
+    /**
+     *  @brief  Collect the clusters whose propagation may be affected by the associations modified since the last call, then reset the modified cluster set
+     * 
+     *  @param  clusterAssociationMap the cluster association map
+     *  @param  affectedClusters to receive the affected clusters
+     */
+    void GetAffectedClusters(const ClusterAssociationMap &clusterAssociationMap, pandora::ClusterSet &affectedClusters) const;
+
     /**
      *  @brief  Unambiguous propagation
      * 
@@ -122,9 +154,12 @@ private:
     void NavigateAlongAssociations(const ClusterAssociationMap &clusterAssociationMap, const pandora::Cluster *const pCluster, const bool isForward,
         const pandora::Cluster *&pExtremalCluster, pandora::ClusterSet &clusterSet) const;
 
-    mutable bool m_mergeMade;
+    mutable bool                m_mergeMade;
+    mutable pandora::ClusterSet m_deletedClusters;                      ///< The clusters deleted by merges during the current run
+    mutable pandora::ClusterSet m_modifiedClusters;                     ///< The clusters whose associations have been modified by recent merges
 
-    bool         m_resolveAmbiguousAssociations;        ///< Whether to resolve ambiguous associations
+    bool                        m_resolveAmbiguousAssociations;         ///< Whether to resolve ambiguous associations
+    bool                        m_worklistPropagation;                  ///< Whether to revisit only clusters affected by merges, rather than sweeping all clusters
 };
 
 } // namespace lar_content
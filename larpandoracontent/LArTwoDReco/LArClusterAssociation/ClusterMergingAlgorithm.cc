@@ -103,6 +103,15 @@ void ClusterMergingAlgorithm::CollectAssociatedClusters(const Cluster *const pSe
 
 void ClusterMergingAlgorithm::CollectAssociatedClusters(const Cluster *const pSeedCluster, const Cluster *const pCurrentCluster, const ClusterMergeMap &clusterMergeMap,
     const ClusterSet &clusterVetoList, ClusterList &associatedClusterList) const
+{
+    ClusterSet associatedClusterSet(associatedClusterList.begin(), associatedClusterList.end());
+    this->CollectAssociatedClusters(pSeedCluster, pCurrentCluster, clusterMergeMap, clusterVetoList, associatedClusterList, associatedClusterSet);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMergingAlgorithm::CollectAssociatedClusters(const Cluster *const pSeedCluster, const Cluster *const pCurrentCluster, const ClusterMergeMap &clusterMergeMap,
+    const ClusterSet &clusterVetoList, ClusterList &associatedClusterList, ClusterSet &associatedClusterSet) const
 {
     if (clusterVetoList.count(pCurrentCluster))
         return;
@@ -120,11 +129,11 @@ void ClusterMergingAlgorithm::CollectAssociatedClusters(const Cluster *const pSe
         if (pAssociatedCluster == pSeedCluster)
             continue;
 
-        if (associatedClusterList.end() != std::find(associatedClusterList.begin(), associatedClusterList.end(), pAssociatedCluster))
+        if (!associatedClusterSet.insert(pAssociatedCluster).second)
             continue;
 
         associatedClusterList.push_back(pAssociatedCluster);
-        this->CollectAssociatedClusters(pSeedCluster, pAssociatedCluster, clusterMergeMap, clusterVetoList, associatedClusterList);
+        this->CollectAssociatedClusters(pSeedCluster, pAssociatedCluster, clusterMergeMap, clusterVetoList, associatedClusterList, associatedClusterSet);
     }
 }
 
@@ -71,6 +71,19 @@ protected:
     void CollectAssociatedClusters(const pandora::Cluster *const pSeedCluster, const pandora::Cluster *const pCurrentCluster, const ClusterMergeMap &clusterMergeMap,
         const pandora::ClusterSet &clusterVetoList, pandora::ClusterList& associatedClusterList) const;
 
+    /**
+     *  @brief  Collect up all clusters associations related to a given seed cluster, using a set to index the clusters already collected
+     *
+     *  @param  pSeedCluster pointer to the initial cluster
+     *  @param  pCurrentCluster pointer to the current cluster
+     *  @param  clusterMergeMap the map of cluster associations
+     *  @param  clusterVetoList the list of clusters that have already been merged
+     *  @param  associatedClusterList the output list of associated clusters
+     *  @param  associatedClusterSet the set of clusters in the output list of associated clusters
+     */
+    void CollectAssociatedClusters(const pandora::Cluster *const pSeedCluster, const pandora::Cluster *const pCurrentCluster, const ClusterMergeMap &clusterMergeMap,
+        const pandora::ClusterSet &clusterVetoList, pandora::ClusterList& associatedClusterList, pandora::ClusterSet &associatedClusterSet) const;
+
     /**
      *  @brief  Sort the selected clusters, so that they have a well-defined ordering
      *
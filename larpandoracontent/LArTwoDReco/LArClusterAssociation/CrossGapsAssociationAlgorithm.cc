@@ -28,12 +28,21 @@ CrossGapsAssociationAlgorithm::CrossGapsAssociationAlgorithm() :
     m_maxOnClusterDistance(1.5f),
     m_minMatchedSamplingPoints(10),
     m_minMatchedSamplingFraction(0.5f),
-    m_gapTolerance(0.f)
+    m_gapTolerance(0.f),
+    m_detectorGapIndex(DetectorGapList())
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CrossGapsAssociationAlgorithm::Run()
+{
+    m_detectorGapIndex = LArGeometryHelper::DetectorGapIndex(this->GetPandora().GetGeometry()->GetDetectorGapList());
+    return ClusterAssociationAlgorithm::Run();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CrossGapsAssociationAlgorithm::GetListOfCleanClusters(const ClusterList *const pClusterList, ClusterVector &clusterVector) const
 {
     // ATTN May want to opt-out completely if no gap information available
@@ -140,7 +149,7 @@ bool CrossGapsAssociationAlgorithm::IsAssociated(const CartesianVector &startPos
         ++nSamplingPoints;
         const CartesianVector samplingPoint(startPosition + startDirection * static_cast<float>(iSample) * m_sampleStepSize);
 
-        if (LArGeometryHelper::IsInGap(this->GetPandora(), samplingPoint, hitType, m_gapTolerance))
+        if (m_detectorGapIndex.IsInGap(samplingPoint, hitType, m_gapTolerance))
         {
             ++nGapSamplingPoints;
             nUnmatchedSampleRun = 0; // ATTN Choose to also reset run when entering gap region
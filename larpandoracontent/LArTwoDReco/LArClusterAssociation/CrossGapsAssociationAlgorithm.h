@@ -10,6 +10,8 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterAssociationAlgorithm.h"
@@ -29,6 +31,7 @@ public:
     CrossGapsAssociationAlgorithm();
 
 private:
+    pandora::StatusCode Run();
     void GetListOfCleanClusters(const pandora::ClusterList *const pClusterList, pandora::ClusterVector &clusterVector) const;
     void PopulateClusterAssociationMap(const pandora::ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const;
     bool IsExtremalCluster(const bool isForward, const pandora::Cluster *const pCurrentCluster, const pandora::Cluster *const pTestCluster) const;
@@ -77,6 +80,8 @@ private:
     unsigned int    m_minMatchedSamplingPoints;     ///< Minimum number of matched sampling points to declare association
     float           m_minMatchedSamplingFraction;   ///< Minimum ratio between matched sampling points and expectation to declare association
     float           m_gapTolerance;                 ///< The tolerance to use when querying whether a sampling point is in a gap, units cm
+
+    LArGeometryHelper::DetectorGapIndex m_detectorGapIndex; ///< The index of the detector gaps, rebuilt from the gap list for each run
 };
 
 } // namespace lar_content
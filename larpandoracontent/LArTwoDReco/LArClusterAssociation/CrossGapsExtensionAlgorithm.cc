@@ -24,12 +24,21 @@ CrossGapsExtensionAlgorithm::CrossGapsExtensionAlgorithm() :
     m_minGapFraction(0.5f),
     m_maxGapTolerance(2.f),
     m_maxTransverseDisplacement(2.5f),
-    m_maxRelativeAngle(10.f)
+    m_maxRelativeAngle(10.f),
+    m_detectorGapIndex(DetectorGapList())
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CrossGapsExtensionAlgorithm::Run()
+{
+    m_detectorGapIndex = LArGeometryHelper::DetectorGapIndex(this->GetPandora().GetGeometry()->GetDetectorGapList());
+    return ClusterExtensionAlgorithm::Run();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CrossGapsExtensionAlgorithm::GetListOfCleanClusters(const ClusterList *const pClusterList, ClusterVector &clusterVector) const
 {
     // ATTN May want to opt-out completely if no gap information available
@@ -115,7 +124,7 @@ void CrossGapsExtensionAlgorithm::BuildPointingClusterList(const bool useInner,
         const LArPointingCluster::Vertex &pointingVertex(useInner ? pointingCluster.GetInnerVertex() : pointingCluster.GetOuterVertex());
         const HitType hitType(LArClusterHelper::GetClusterHitType(pointingCluster.GetCluster()));
 
-        if (LArGeometryHelper::IsInGap(this->GetPandora(), pointingVertex.GetPosition(), hitType, m_maxGapTolerance))
+        if (m_detectorGapIndex.IsInGap(pointingVertex.GetPosition(), hitType, m_maxGapTolerance))
             outputPointingClusterList.push_back(pointingCluster);
     }
 }
@@ -141,7 +150,7 @@ bool CrossGapsExtensionAlgorithm::IsAcrossGap(const float minZ, const float maxZ
     if (maxZ - minZ < std::numeric_limits<float>::epsilon())
         return false;
 
-    const float gapDeltaZ(LArGeometryHelper::CalculateGapDeltaZ(this->GetPandora(), minZ, maxZ, hitType));
+    const float gapDeltaZ(m_detectorGapIndex.CalculateGapDeltaZ(minZ, maxZ, hitType));
 
     if (gapDeltaZ / (maxZ - minZ) < m_minGapFraction)
         return false;
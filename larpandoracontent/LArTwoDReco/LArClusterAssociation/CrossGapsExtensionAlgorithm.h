@@ -8,6 +8,8 @@
 #ifndef LAR_CROSS_GAPS_EXTENSION_ALGORITHM_H
 #define LAR_GROSS_GAPS_EXTENSION_ALGORITHM_H 1
 
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterExtensionAlgorithm.h"
@@ -27,6 +29,7 @@ public:
     CrossGapsExtensionAlgorithm();
 
 private:
+    pandora::StatusCode Run();
     void GetListOfCleanClusters(const pandora::ClusterList *const pClusterList, pandora::ClusterVector &clusterVector) const;
     void FillClusterAssociationMatrix(const pandora::ClusterVector &clusterVector, ClusterAssociationMatrix &clusterAssociationMatrix) const;
     void FillClusterMergeMap(const ClusterAssociationMatrix &clusterAssociationMatrix, ClusterMergeMap &clusterMergeMap) const;
@@ -75,6 +78,8 @@ private:
     float   m_maxGapTolerance;                ///<
     float   m_maxTransverseDisplacement;      ///<
     float   m_maxRelativeAngle;               ///<
+
+    LArGeometryHelper::DetectorGapIndex m_detectorGapIndex; ///< The index of the detector gaps, rebuilt from the gap list for each run
 };
 
 } // namespace lar_content
@@ -8,6 +8,8 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArProfilingHelper.h"
+
 #include "larpandoracontent/LArTwoDReco/LArClusterCreation/ClusteringParentAlgorithm.h"
 
 using namespace pandora;
@@ -46,12 +48,18 @@ StatusCode ClusteringParentAlgorithm::Run()
     // Run the initial cluster formation algorithm
     const ClusterList *pClusterList = NULL;
     std::string newClusterListName;
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunClusteringAlgorithm(*this, m_clusteringAlgorithmName,
-        pClusterList, newClusterListName));
+    {
+        const LArProfilingHelper::ScopedTimer scopedTimer(this, m_clusteringAlgorithmName);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunClusteringAlgorithm(*this, m_clusteringAlgorithmName,
+            pClusterList, newClusterListName));
+    }
 
     // Run the topological association algorithms to modify clusters
     if (!pClusterList->empty() && !m_associationAlgorithmName.empty())
+    {
+        const LArProfilingHelper::ScopedTimer scopedTimer(this, m_associationAlgorithmName);
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, m_associationAlgorithmName));
+    }
 
     // Save the new cluster list
     if (!pClusterList->empty())
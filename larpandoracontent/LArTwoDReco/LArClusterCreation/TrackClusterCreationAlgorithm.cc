@@ -72,15 +72,20 @@ StatusCode TrackClusterCreationAlgorithm::FilterCaloHits(const CaloHitList *cons
 
     for (OrderedCaloHitList::const_iterator iter = selectedCaloHitList.begin(), iterEnd = selectedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
+        const SortedLayerHits sortedLayerHits(*iter->second);
+        const CaloHitVector &caloHits(sortedLayerHits.m_caloHits);
 
         for (const CaloHit *const pCaloHitI : caloHits)
         {
             bool useCaloHit(true);
 
-            for (const CaloHit *const pCaloHitJ : caloHits)
+            HitIndexVector hitIndices;
+            this->GetHitsInXWindow(pCaloHitI->GetPositionVector().GetX(), sortedLayerHits.m_xPositionIndex, m_minCaloHitSeparationSquared, hitIndices);
+
+            for (const unsigned int hitIndexJ : hitIndices)
             {
+                const CaloHit *const pCaloHitJ(caloHits.at(hitIndexJ));
+
                 if (pCaloHitI == pCaloHitJ)
                     continue;
 
@@ -119,6 +124,11 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(const OrderedCaloH
         CaloHitVector clusteredHits(pCaloHitList->begin(), pCaloHitList->end());
         std::sort(clusteredHits.begin(), clusteredHits.end(), LArClusterHelper::SortHitsByPosition);
 
+        XPositionIndex clusteredHitIndex;
+
+        for (unsigned int hitIndex = 0; hitIndex < clusteredHits.size(); ++hitIndex)
+            clusteredHitIndex.insert(XPositionIndex::value_type(clusteredHits.at(hitIndex)->GetPositionVector().GetX(), hitIndex));
+
         bool carryOn(true);
 
         while (carryOn)
@@ -137,8 +147,14 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(const OrderedCaloH
                 const CaloHit *pClosestHit = NULL;
                 float closestSeparationSquared(m_minCaloHitSeparationSquared);
 
-                for (const CaloHit *const pCaloHitJ : clusteredHits)
+                // ATTN Candidates are visited in clustered hit order, so ties are resolved exactly as for a scan over all clustered hits
+                HitIndexVector hitIndices;
+                this->GetHitsInXWindow(pCaloHitI->GetPositionVector().GetX(), clusteredHitIndex, m_minCaloHitSeparationSquared, hitIndices);
+
+                for (const unsigned int hitIndexJ : hitIndices)
                 {
+                    const CaloHit *const pCaloHitJ(clusteredHits.at(hitIndexJ));
+
                     if (pCaloHitI->GetMipEquivalentEnergy() > pCaloHitJ->GetMipEquivalentEnergy())
                         continue;
 
@@ -169,6 +185,7 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(const OrderedCaloH
 
             for (const CaloHit *const pCaloHit : newClusteredHits)
             {
+                clusteredHitIndex.insert(XPositionIndex::value_type(pCaloHit->GetPositionVector().GetX(), clusteredHits.size()));
                 clusteredHits.push_back(pCaloHit);
                 unavailableHits.insert(pCaloHit);
             }
@@ -183,25 +200,33 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(const OrderedCaloH
 void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
     HitAssociationMap &backwardHitAssociationMap) const
 {
+    // Sort each pseudo layer once, rather than once per pair of layers
+    SortedLayerHitsMap sortedLayerHitsMap;
+
+    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+        (void) sortedLayerHitsMap.insert(SortedLayerHitsMap::value_type(iter->first, SortedLayerHits(*iter->second)));
+
     for (OrderedCaloHitList::const_iterator iterI = orderedCaloHitList.begin(), iterIEnd = orderedCaloHitList.end(); iterI != iterIEnd; ++iterI)
     {
         unsigned int nLayersConsidered(0);
 
-        CaloHitVector caloHitsI(iterI->second->begin(), iterI->second->end());
-        std::sort(caloHitsI.begin(), caloHitsI.end(), LArClusterHelper::SortHitsByPosition);
+        const CaloHitVector &caloHitsI(sortedLayerHitsMap.at(iterI->first).m_caloHits);
 
         for (OrderedCaloHitList::const_iterator iterJ = iterI, iterJEnd = orderedCaloHitList.end(); (nLayersConsidered++ <= m_maxGapLayers + 1) && (iterJ != iterJEnd); ++iterJ)
         {
             if (iterJ->first == iterI->first || iterJ->first > iterI->first + m_maxGapLayers + 1)
                 continue;
 
-            CaloHitVector caloHitsJ(iterJ->second->begin(), iterJ->second->end());
-            std::sort(caloHitsJ.begin(), caloHitsJ.end(), LArClusterHelper::SortHitsByPosition);
+            const SortedLayerHits &sortedLayerHitsJ(sortedLayerHitsMap.at(iterJ->first));
 
             for (const CaloHit *const pCaloHitI : caloHitsI)
             {
-                for (const CaloHit *const pCaloHitJ : caloHitsJ)
-                    this->CreatePrimaryAssociation(pCaloHitI, pCaloHitJ, forwardHitAssociationMap, backwardHitAssociationMap);
+                // ATTN Hits outside the x window cannot pass the separation cut, so skipping them leaves the sequence of associations unchanged
+                HitIndexVector hitIndices;
+                this->GetHitsInXWindow(pCaloHitI->GetPositionVector().GetX(), sortedLayerHitsJ.m_xPositionIndex, m_maxCaloHitSeparationSquared, hitIndices);
+
+                for (const unsigned int hitIndexJ : hitIndices)
+                    this->CreatePrimaryAssociation(pCaloHitI, sortedLayerHitsJ.m_caloHits.at(hitIndexJ), forwardHitAssociationMap, backwardHitAssociationMap);
             }
         }
     }
@@ -435,6 +460,50 @@ const CaloHit *TrackClusterCreationAlgorithm::TraceHitAssociation(const CaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TrackClusterCreationAlgorithm::GetHitsInXWindow(const float x, const XPositionIndex &xPositionIndex, const float maxSeparationSquared,
+    HitIndexVector &hitIndices) const
+{
+    // ATTN The separation in x is monotonic along the index in either direction, so each sweep can stop at the first hit outside the window
+    const XPositionIndex::const_iterator startIter(xPositionIndex.lower_bound(x));
+
+    for (XPositionIndex::const_iterator iter = startIter, iterEnd = xPositionIndex.end(); iter != iterEnd; ++iter)
+    {
+        const float deltaX(iter->first - x);
+
+        if (deltaX * deltaX > maxSeparationSquared)
+            break;
+
+        hitIndices.push_back(iter->second);
+    }
+
+    for (XPositionIndex::const_reverse_iterator iter = XPositionIndex::const_reverse_iterator(startIter), iterEnd = xPositionIndex.rend(); iter != iterEnd; ++iter)
+    {
+        const float deltaX(x - iter->first);
+
+        if (deltaX * deltaX > maxSeparationSquared)
+            break;
+
+        hitIndices.push_back(iter->second);
+    }
+
+    std::sort(hitIndices.begin(), hitIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrackClusterCreationAlgorithm::SortedLayerHits::SortedLayerHits(const CaloHitList &caloHitList) :
+    m_caloHits(caloHitList.begin(), caloHitList.end())
+{
+    std::sort(m_caloHits.begin(), m_caloHits.end(), LArClusterHelper::SortHitsByPosition);
+
+    for (unsigned int hitIndex = 0; hitIndex < m_caloHits.size(); ++hitIndex)
+        m_xPositionIndex.insert(XPositionIndex::value_type(m_caloHits.at(hitIndex)->GetPositionVector().GetX(), hitIndex));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackClusterCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -10,6 +10,7 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <map>
 #include <unordered_map>
 
 namespace lar_content
@@ -88,6 +89,28 @@ private:
     typedef std::unordered_map<const pandora::CaloHit*, const pandora::CaloHit*> HitJoinMap;
     typedef std::unordered_map<const pandora::CaloHit*, const pandora::Cluster*> HitToClusterMap;
 
+    typedef std::multimap<float, unsigned int> XPositionIndex;  ///< Map from hit x coordinate to hit index, ATTN avoid map.find, etc. with float key
+    typedef std::vector<unsigned int> HitIndexVector;
+
+    /**
+     *  @brief  SortedLayerHits class, holding the hits in a pseudo layer sorted by position, together with an index by x coordinate
+     */
+    class SortedLayerHits
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  caloHitList the calo hits in the pseudo layer
+         */
+        SortedLayerHits(const pandora::CaloHitList &caloHitList);
+
+        pandora::CaloHitVector  m_caloHits;                     ///< The calo hits, sorted by position
+        XPositionIndex          m_xPositionIndex;               ///< The index from x coordinate to position in the sorted calo hit vector
+    };
+
+    typedef std::map<unsigned int, SortedLayerHits> SortedLayerHitsMap;
+
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -195,6 +218,17 @@ private:
     const pandora::CaloHit *TraceHitAssociation(const pandora::CaloHit *const pCaloHit, const HitAssociationMap &hitAssociationMapI, const HitAssociationMap &hitAssociationMapJ,
         unsigned int &nSteps) const;
 
+    /**
+     *  @brief  Get the indices of hits whose separation in x from a given x coordinate does not exceed a maximum, as a necessary condition for
+     *          their full separation not to exceed the maximum. Indices are returned in increasing order, to preserve hit ordering.
+     *
+     *  @param  x the x coordinate
+     *  @param  xPositionIndex the index from hit x coordinate to hit index
+     *  @param  maxSeparationSquared the maximum separation squared
+     *  @param  hitIndices to receive the hit indices
+     */
+    void GetHitsInXWindow(const float x, const XPositionIndex &xPositionIndex, const float maxSeparationSquared, HitIndexVector &hitIndices) const;
+
     bool                m_mergeBackFilteredHits;        ///< Merge rejected hits into their associated clusters
     unsigned int        m_maxGapLayers;                 ///< Maximum number of layers for a gap
     float               m_maxCaloHitSeparationSquared;  ///< Square of maximum calo hit separation
@@ -12,13 +12,25 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/ClusterSplittingAlgorithm.h"
 
+#include <algorithm>
+#include <thread>
+
 using namespace pandora;
 
 namespace lar_content
 {
 
+ClusterSplittingAlgorithm::ClusterSplittingAlgorithm() :
+    m_nDivisionThreads(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterSplittingAlgorithm::Run()
 {
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareDivision());
+
     if (m_inputClusterListNames.empty())
         return this->RunUsingCurrentList();
 
@@ -57,6 +69,9 @@ StatusCode ClusterSplittingAlgorithm::RunUsingCurrentList() const
     ClusterList internalClusterList(pClusterList->begin(), pClusterList->end());
     internalClusterList.sort(LArClusterHelper::SortByNHits);
 
+    if (m_nDivisionThreads > 0)
+        return this->RunUsingParallelDivision(internalClusterList);
+
     for (ClusterList::iterator iter = internalClusterList.begin(); iter != internalClusterList.end(); ++iter)
     {
         const Cluster *const pCluster = *iter;
@@ -74,17 +89,120 @@ StatusCode ClusterSplittingAlgorithm::RunUsingCurrentList() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ClusterSplittingAlgorithm::PrepareDivision()
+{
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterSplittingAlgorithm::RunUsingParallelDivision(const ClusterList &clusterList) const
+{
+    // ATTN Fragments are processed after all clusters in the current round, exactly as when they are spliced onto the end of the serial list
+    ClusterVector clusterVector(clusterList.begin(), clusterList.end());
+
+    while (!clusterVector.empty())
+    {
+        HitDivisionVector hitDivisionVector(clusterVector.size());
+        this->GetHitDivisions(clusterVector, hitDivisionVector);
+
+        ClusterVector fragmentVector;
+
+        for (unsigned int iCluster = 0; iCluster < clusterVector.size(); ++iCluster)
+        {
+            HitDivision &hitDivision(hitDivisionVector.at(iCluster));
+
+            if (hitDivision.m_exceptionPtr)
+                std::rethrow_exception(hitDivision.m_exceptionPtr);
+
+            if (STATUS_CODE_SUCCESS != hitDivision.m_statusCode)
+                continue;
+
+            ClusterList clusterSplittingList;
+
+            if (STATUS_CODE_SUCCESS != this->SplitCluster(clusterVector.at(iCluster), hitDivision.m_firstCaloHitList, hitDivision.m_secondCaloHitList,
+                clusterSplittingList))
+            {
+                continue;
+            }
+
+            fragmentVector.insert(fragmentVector.end(), clusterSplittingList.begin(), clusterSplittingList.end());
+        }
+
+        clusterVector.swap(fragmentVector);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterSplittingAlgorithm::GetHitDivisions(const ClusterVector &clusterVector, HitDivisionVector &hitDivisionVector) const
+{
+    if (hitDivisionVector.size() != clusterVector.size())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // ATTN DivideCaloHits must not call the content api, which is not thread safe; derived algorithms fetch any lists in PrepareDivision
+    std::atomic<unsigned int> nextIndex(0);
+    const unsigned int nThreads(std::min(m_nDivisionThreads, static_cast<unsigned int>(clusterVector.size())));
+
+    std::vector<std::thread> threadVector;
+
+    for (unsigned int iThread = 1; iThread < nThreads; ++iThread)
+        threadVector.push_back(std::thread(&ClusterSplittingAlgorithm::GetHitDivisionsWorker, this, &clusterVector, &nextIndex, &hitDivisionVector));
+
+    ClusterSplittingAlgorithm::GetHitDivisionsWorker(this, &clusterVector, &nextIndex, &hitDivisionVector);
+
+    for (std::thread &thread : threadVector)
+        thread.join();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterSplittingAlgorithm::GetHitDivisionsWorker(const ClusterSplittingAlgorithm *const pAlgorithm, const ClusterVector *const pClusterVector,
+    std::atomic<unsigned int> *const pNextIndex, HitDivisionVector *const pHitDivisionVector)
+{
+    for (unsigned int iCluster = (*pNextIndex)++; iCluster < pClusterVector->size(); iCluster = (*pNextIndex)++)
+    {
+        HitDivision &hitDivision(pHitDivisionVector->at(iCluster));
+
+        try
+        {
+            hitDivision.m_statusCode = pAlgorithm->DivideCaloHits(pClusterVector->at(iCluster), hitDivision.m_firstCaloHitList,
+                hitDivision.m_secondCaloHitList);
+        }
+        catch (...)
+        {
+            hitDivision.m_exceptionPtr = std::current_exception();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster, ClusterList &clusterSplittingList) const
 {
     // Split cluster into two CaloHit lists
-    PandoraContentApi::Cluster::Parameters firstParameters, secondParameters;
+    CaloHitList firstCaloHitList, secondCaloHitList;
 
-    if (STATUS_CODE_SUCCESS != this->DivideCaloHits(pCluster, firstParameters.m_caloHitList, secondParameters.m_caloHitList))
+    if (STATUS_CODE_SUCCESS != this->DivideCaloHits(pCluster, firstCaloHitList, secondCaloHitList))
         return STATUS_CODE_NOT_FOUND;
 
-    if (firstParameters.m_caloHitList.empty() || secondParameters.m_caloHitList.empty())
+    return this->SplitCluster(pCluster, firstCaloHitList, secondCaloHitList, clusterSplittingList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster, CaloHitList &firstCaloHitList, CaloHitList &secondCaloHitList,
+    ClusterList &clusterSplittingList) const
+{
+    if (firstCaloHitList.empty() || secondCaloHitList.empty())
         return STATUS_CODE_NOT_ALLOWED;
 
+    PandoraContentApi::Cluster::Parameters firstParameters, secondParameters;
+    firstParameters.m_caloHitList.swap(firstCaloHitList);
+    secondParameters.m_caloHitList.swap(secondCaloHitList);
+
     // Begin cluster fragmentation operations
     const ClusterList clusterList(1, pCluster);
     std::string clusterListToSaveName, clusterListToDeleteName;
@@ -106,6 +224,15 @@ StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterSplittingAlgorithm::HitDivision::HitDivision() :
+    m_statusCode(STATUS_CODE_NOT_FOUND)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode ClusterSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
@@ -113,6 +240,9 @@ StatusCode ClusterSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
         "InputClusterListNames", m_inputClusterListNames));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NDivisionThreads", m_nDivisionThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
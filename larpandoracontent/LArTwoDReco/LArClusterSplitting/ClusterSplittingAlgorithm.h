@@ -10,7 +10,10 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <atomic>
+#include <exception>
 #include <list>
+#include <vector>
 
 namespace lar_content
 {
@@ -20,6 +23,12 @@ namespace lar_content
  */
 class ClusterSplittingAlgorithm : public pandora::Algorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ClusterSplittingAlgorithm();
+
 protected:
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -29,6 +38,11 @@ protected:
      */
     pandora::StatusCode RunUsingCurrentList() const;
 
+    /**
+     *  @brief  Prepare any event-level information required by DivideCaloHits, called on the calling thread before any cluster is divided
+     */
+    virtual pandora::StatusCode PrepareDivision();
+
     /**
      *  @brief  Divide calo hits in a cluster into two lists, each associated with a separate fragment cluster
      *
@@ -40,6 +54,52 @@ protected:
         pandora::CaloHitList &secondCaloHitList) const = 0;
 
 private:
+    /**
+     *  @brief  HitDivision class, the split decision for a single cluster
+     */
+    class HitDivision
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        HitDivision();
+
+        pandora::StatusCode     m_statusCode;           ///< The status code returned by DivideCaloHits
+        pandora::CaloHitList    m_firstCaloHitList;     ///< The hits in the first fragment
+        pandora::CaloHitList    m_secondCaloHitList;    ///< The hits in the second fragment
+        std::exception_ptr      m_exceptionPtr;         ///< Any exception thrown by DivideCaloHits, to be rethrown on the calling thread
+    };
+
+    typedef std::vector<HitDivision> HitDivisionVector;
+
+    /**
+     *  @brief  Run the algorithm using the current cluster list as input, first deciding how to split each cluster concurrently and
+     *          then applying the fragmentation operations serially, in the same order as the serial implementation
+     *
+     *  @param  clusterList the sorted list of input clusters
+     */
+    pandora::StatusCode RunUsingParallelDivision(const pandora::ClusterList &clusterList) const;
+
+    /**
+     *  @brief  Decide how to split each cluster in a vector, using a pool of worker threads
+     *
+     *  @param  clusterVector the vector of clusters
+     *  @param  hitDivisionVector to receive the split decision for each cluster, in the order of the cluster vector
+     */
+    void GetHitDivisions(const pandora::ClusterVector &clusterVector, HitDivisionVector &hitDivisionVector) const;
+
+    /**
+     *  @brief  Worker thread function, taking clusters from a shared index until the cluster vector is exhausted
+     *
+     *  @param  pAlgorithm address of the cluster splitting algorithm
+     *  @param  pClusterVector address of the vector of clusters
+     *  @param  pNextIndex address of the shared index of the next cluster to process
+     *  @param  pHitDivisionVector address of the vector to receive the split decisions
+     */
+    static void GetHitDivisionsWorker(const ClusterSplittingAlgorithm *const pAlgorithm, const pandora::ClusterVector *const pClusterVector,
+        std::atomic<unsigned int> *const pNextIndex, HitDivisionVector *const pHitDivisionVector);
+
     /**
      *  @brief  Split cluster into two fragments
      *
@@ -48,7 +108,19 @@ private:
      */
     pandora::StatusCode SplitCluster(const pandora::Cluster *const pCluster, pandora::ClusterList &clusterSplittingList) const;
 
+    /**
+     *  @brief  Split cluster into two fragments, using the provided hit lists
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  firstCaloHitList the hits in the first fragment, contents will be consumed
+     *  @param  secondCaloHitList the hits in the second fragment, contents will be consumed
+     *  @param  clusterSplittingList to receive the two cluster fragments
+     */
+    pandora::StatusCode SplitCluster(const pandora::Cluster *const pCluster, pandora::CaloHitList &firstCaloHitList,
+        pandora::CaloHitList &secondCaloHitList, pandora::ClusterList &clusterSplittingList) const;
+
     pandora::StringVector   m_inputClusterListNames;    ///< The list of input cluster list names - if empty, use the current cluster list
+    unsigned int            m_nDivisionThreads;         ///< The number of threads with which to decide cluster splits - if zero, run serially
 };
 
 } // namespace lar_content
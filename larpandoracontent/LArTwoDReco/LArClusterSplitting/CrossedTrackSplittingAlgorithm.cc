@@ -240,6 +240,14 @@ StatusCode CrossedTrackSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CrossedTrackSplittingAlgorithm::GetInteractionDistance() const
+{
+    // ATTN Split positions are only sought for clusters with a closest hit separation within the maximum cluster separation
+    return m_maxClusterSeparation;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CrossedTrackSplittingAlgorithm::FindCandidateSplitPositions(const Cluster *const pCluster1, const Cluster *const pCluster2,
     CartesianPointVector &candidateVector) const
 {
@@ -44,6 +44,7 @@ private:
     pandora::StatusCode TidyUpStep();
     pandora::StatusCode FindBestSplitPosition(const TwoDSlidingFitResult &slidingFit1, const TwoDSlidingFitResult &slidingFit2,
         pandora::CartesianVector &splitPosition, pandora::CartesianVector &direction1, pandora::CartesianVector &direction2) const;
+    float GetInteractionDistance() const;
 
     /**
      *  @brief Find average positions of pairs of hits within a maximum separation
@@ -13,6 +13,8 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitSplittingAndSwitchingAlgorithm.h"
 
+#include <limits>
+
 using namespace pandora;
 
 namespace lar_content
@@ -20,7 +22,8 @@ namespace lar_content
 
 TwoDSlidingFitSplittingAndSwitchingAlgorithm::TwoDSlidingFitSplittingAndSwitchingAlgorithm() :
     m_halfWindowLayers(25),
-    m_minClusterLength(10.f)
+    m_minClusterLength(10.f),
+    m_useBoundingBoxPreFilter(false)
 {
 }
 
@@ -42,25 +45,39 @@ StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::Run()
     // May choose to cache information here, for subsequent expensive calculations
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PreparationStep(clusterVector));
 
+    // Optionally restrict the search to pairs of clusters with nearby bounding boxes. ATTN Pairs whose boxes are separated by more than
+    // the interaction distance have a larger closest hit separation, so FindBestSplitPosition could only fail for them; later partners
+    // are still visited in vector order, so the splits made are identical with and without the pre-filter
+    const float interactionDistance(this->GetInteractionDistance());
+    const bool usePreFilter(m_useBoundingBoxPreFilter && (interactionDistance < std::numeric_limits<float>::max()));
+
+    CandidateIndicesVector candidateIndicesVector;
+
+    if (usePreFilter)
+        this->GetCandidateIndices(clusterVector, interactionDistance, candidateIndicesVector);
+
     // Loop over clusters, identify split positions, perform splits
-    for (ClusterVector::iterator iter1 = clusterVector.begin(), iterEnd1 = clusterVector.end(); iter1 != iterEnd1; ++iter1)
+    for (unsigned int index1 = 0, nClusters = clusterVector.size(); index1 < nClusters; ++index1)
     {
-        if (NULL == *iter1)
+        if (NULL == clusterVector.at(index1))
             continue;
 
-        TwoDSlidingFitResultMap::iterator sIter1 = slidingFitResultMap.find(*iter1);
+        TwoDSlidingFitResultMap::iterator sIter1 = slidingFitResultMap.find(clusterVector.at(index1));
 
         if (slidingFitResultMap.end() == sIter1)
             continue;
 
         const TwoDSlidingFitResult &slidingFitResult1(sIter1->second);
+        const unsigned int nCandidates(usePreFilter ? candidateIndicesVector.at(index1).size() : nClusters - index1);
 
-        for (ClusterVector::iterator iter2 = iter1, iterEnd2 = iterEnd1; iter2 != iterEnd2; ++iter2)
+        for (unsigned int iCandidate = 0; iCandidate < nCandidates; ++iCandidate)
         {
-            if (NULL == *iter2)
+            const unsigned int index2(usePreFilter ? candidateIndicesVector.at(index1).at(iCandidate) : index1 + iCandidate);
+
+            if (NULL == clusterVector.at(index2))
                 continue;
 
-            TwoDSlidingFitResultMap::iterator sIter2 = slidingFitResultMap.find(*iter2);
+            TwoDSlidingFitResultMap::iterator sIter2 = slidingFitResultMap.find(clusterVector.at(index2));
 
             if (slidingFitResultMap.end() == sIter2)
                 continue;
@@ -86,8 +103,8 @@ StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::Run()
             slidingFitResultMap.erase(sIter1);
             slidingFitResultMap.erase(sIter2);
 
-            *iter1 = NULL;
-            *iter2 = NULL;
+            clusterVector.at(index1) = NULL;
+            clusterVector.at(index2) = NULL;
 
             break;
         }
@@ -112,6 +129,63 @@ StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::TidyUpStep()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float TwoDSlidingFitSplittingAndSwitchingAlgorithm::GetInteractionDistance() const
+{
+    return std::numeric_limits<float>::max();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitSplittingAndSwitchingAlgorithm::GetCandidateIndices(const ClusterVector &clusterVector, const float interactionDistance,
+    CandidateIndicesVector &candidateIndicesVector) const
+{
+    // Expand the boxes a little beyond the interaction distance, as the closest hit separation is calculated with different rounding
+    const float padding(1.01f * interactionDistance + 0.1f);
+    const unsigned int nClusters(clusterVector.size());
+
+    CartesianPointVector minimumCoordinates, maximumCoordinates;
+    std::vector<std::pair<float, unsigned int>> sortedIndices;
+
+    for (unsigned int index = 0; index < nClusters; ++index)
+    {
+        CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+        LArClusterHelper::GetClusterBoundingBox(clusterVector.at(index), minimumCoordinate, maximumCoordinate);
+
+        minimumCoordinates.push_back(minimumCoordinate);
+        maximumCoordinates.push_back(maximumCoordinate);
+        sortedIndices.push_back(std::make_pair(minimumCoordinate.GetX(), index));
+    }
+
+    std::sort(sortedIndices.begin(), sortedIndices.end());
+    candidateIndicesVector.assign(nClusters, CandidateIndices());
+
+    for (unsigned int iSorted1 = 0; iSorted1 < nClusters; ++iSorted1)
+    {
+        const unsigned int index1(sortedIndices.at(iSorted1).second);
+
+        for (unsigned int iSorted2 = iSorted1 + 1; iSorted2 < nClusters; ++iSorted2)
+        {
+            const unsigned int index2(sortedIndices.at(iSorted2).second);
+
+            if (minimumCoordinates.at(index2).GetX() > maximumCoordinates.at(index1).GetX() + padding)
+                break;
+
+            if ((minimumCoordinates.at(index2).GetZ() > maximumCoordinates.at(index1).GetZ() + padding) ||
+                (minimumCoordinates.at(index1).GetZ() > maximumCoordinates.at(index2).GetZ() + padding))
+            {
+                continue;
+            }
+
+            candidateIndicesVector.at(std::min(index1, index2)).push_back(std::max(index1, index2));
+        }
+    }
+
+    for (CandidateIndices &candidateIndices : candidateIndicesVector)
+        std::sort(candidateIndices.begin(), candidateIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TwoDSlidingFitSplittingAndSwitchingAlgorithm::GetListOfCleanClusters(const ClusterList *const pClusterList, ClusterVector &clusterVector) const
 {
     for (ClusterList::const_iterator iter = pClusterList->begin(), iterEnd = pClusterList->end(); iter != iterEnd; ++iter)
@@ -221,6 +295,9 @@ StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::ReadSettings(const TiXm
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "MinClusterLength", m_minClusterLength));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "UseBoundingBoxPreFilter", m_useBoundingBoxPreFilter));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -54,7 +54,29 @@ protected:
     virtual pandora::StatusCode FindBestSplitPosition(const TwoDSlidingFitResult &slidingFit1, const TwoDSlidingFitResult &slidingFit2,
         pandora::CartesianVector &splitPosition, pandora::CartesianVector &direction1, pandora::CartesianVector &direction2) const = 0;
 
+    /**
+     *  @brief  Get the interaction distance, the closest hit separation beyond which FindBestSplitPosition never finds a split position.
+     *          Derived algorithms without such a bound keep the base implementation, for which no pairs are ever pre-filtered.
+     *
+     *  @return the interaction distance
+     */
+    virtual float GetInteractionDistance() const;
+
 private:
+    typedef std::vector<unsigned int> CandidateIndices;
+    typedef std::vector<CandidateIndices> CandidateIndicesVector;
+
+    /**
+     *  @brief  Use a sweep in x over cluster bounding boxes, expanded by the interaction distance, to identify pairs of clusters
+     *          that may be close enough for a split position to be found
+     *
+     *  @param  clusterVector the cluster vector
+     *  @param  interactionDistance the interaction distance
+     *  @param  candidateIndicesVector to receive, for each cluster, the ordered indices of later clusters in the vector that may interact
+     */
+    void GetCandidateIndices(const pandora::ClusterVector &clusterVector, const float interactionDistance,
+        CandidateIndicesVector &candidateIndicesVector) const;
+
     /**
      *  @brief  Populate cluster vector with subset of cluster list, containing clusters judged to be clean
      *
@@ -97,8 +119,9 @@ private:
         const pandora::CartesianVector &splitPosition, const pandora::CartesianVector &firstDirection,
         const pandora::CartesianVector &secondDirection) const;
 
-    unsigned int  m_halfWindowLayers;     ///< half window layers for sliding linear fot
-    float         m_minClusterLength;     ///< minimum length of clusters
+    unsigned int  m_halfWindowLayers;           ///< half window layers for sliding linear fot
+    float         m_minClusterLength;           ///< minimum length of clusters
+    bool          m_useBoundingBoxPreFilter;    ///< whether to skip pairs of clusters with bounding boxes beyond the interaction distance
 };
 
 } // namespace lar_content
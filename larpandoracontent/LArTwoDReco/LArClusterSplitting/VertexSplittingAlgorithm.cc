@@ -20,7 +20,9 @@ namespace lar_content
 
 VertexSplittingAlgorithm::VertexSplittingAlgorithm() :
     m_splitDisplacementSquared(4.f * 4.f),
-    m_vertexDisplacementSquared(1.f * 1.f)
+    m_vertexDisplacementSquared(1.f * 1.f),
+    m_pSelectedVertex(NULL),
+    m_vertexStatusCode(STATUS_CODE_NOT_INITIALIZED)
 {
     // ATTN Some default values differ from base class
     m_minClusterLength = 1.f;
@@ -28,27 +30,48 @@ VertexSplittingAlgorithm::VertexSplittingAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode VertexSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidingFitResult &slidingFitResult, CartesianVector &splitPosition) const
+StatusCode VertexSplittingAlgorithm::PrepareDivision()
 {
-    // Identify event vertex
+    // Identify event vertex on the calling thread, as split positions may be found concurrently
+    m_pSelectedVertex = NULL;
+
     const VertexList *pVertexList(NULL);
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pVertexList));
+    m_vertexStatusCode = PandoraContentApi::GetCurrentList(*this, pVertexList);
+
+    if (STATUS_CODE_SUCCESS != m_vertexStatusCode)
+        return STATUS_CODE_SUCCESS;
 
     if (pVertexList->empty())
-        return STATUS_CODE_NOT_INITIALIZED;
+    {
+        m_vertexStatusCode = STATUS_CODE_NOT_INITIALIZED;
+    }
+    else if (pVertexList->size() != 1)
+    {
+        m_vertexStatusCode = STATUS_CODE_OUT_OF_RANGE;
+    }
+    else if (VERTEX_3D != (*(pVertexList->begin()))->GetVertexType())
+    {
+        m_vertexStatusCode = STATUS_CODE_INVALID_PARAMETER;
+    }
+    else
+    {
+        m_pSelectedVertex = *(pVertexList->begin());
+    }
 
-    if (pVertexList->size() != 1)
-        return STATUS_CODE_OUT_OF_RANGE;
+    return STATUS_CODE_SUCCESS;
+}
 
-    const Cluster *const pCluster(slidingFitResult.GetCluster());
-    const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    const Vertex *const pSelectedVertex(*(pVertexList->begin()));
+StatusCode VertexSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidingFitResult &slidingFitResult, CartesianVector &splitPosition) const
+{
+    if (STATUS_CODE_SUCCESS != m_vertexStatusCode)
+        return m_vertexStatusCode;
 
-    if (VERTEX_3D != pSelectedVertex->GetVertexType())
-        return STATUS_CODE_INVALID_PARAMETER;
+    const Cluster *const pCluster(slidingFitResult.GetCluster());
+    const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
 
-    const CartesianVector theVertex2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pSelectedVertex->GetPosition(), hitType));
+    const CartesianVector theVertex2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), m_pSelectedVertex->GetPosition(), hitType));
 
     const CartesianVector innerVertex2D(slidingFitResult.GetGlobalMinLayerPosition());
     const CartesianVector outerVertex2D(slidingFitResult.GetGlobalMaxLayerPosition());
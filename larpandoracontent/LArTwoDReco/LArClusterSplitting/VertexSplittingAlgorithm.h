@@ -28,10 +28,14 @@ public:
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+    pandora::StatusCode PrepareDivision();
     pandora::StatusCode FindBestSplitPosition(const TwoDSlidingFitResult &slidingFitResult, pandora::CartesianVector &splitPosition) const;
 
-    float           m_splitDisplacementSquared;     ///< Maximum displacement squared
-    float           m_vertexDisplacementSquared;    ///< Maximum displacement squared
+    float                       m_splitDisplacementSquared;     ///< Maximum displacement squared
+    float                       m_vertexDisplacementSquared;    ///< Maximum displacement squared
+
+    const pandora::Vertex      *m_pSelectedVertex;              ///< The selected event vertex, fetched before any cluster is divided
+    pandora::StatusCode         m_vertexStatusCode;             ///< The status code from identifying the selected event vertex
 };
 
 } // namespace lar_content
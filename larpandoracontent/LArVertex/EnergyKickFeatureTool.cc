@@ -48,6 +48,32 @@ void EnergyKickFeatureTool::Run(SupportVectorMachine::DoubleVector &featureVecto
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EnergyKickFeatureTool::RunBatch(SupportVectorMachine::DoubleVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+    const VertexSelectionBaseAlgorithm::VertexPositionBatchMap &vertexPositionBatchMap,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataBatchMap &slidingFitDataBatchMap, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &)
+{
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+       std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    const unsigned int nVertices(vertexPositionBatchMap.at(TPC_VIEW_U).GetNVertices());
+    FloatVector energyKickU(nVertices, 0.f), energyKickV(nVertices, 0.f), energyKickW(nVertices, 0.f);
+
+    this->GetEnergyKicksForView(vertexPositionBatchMap.at(TPC_VIEW_U), slidingFitDataBatchMap.at(TPC_VIEW_U), energyKickU);
+    this->GetEnergyKicksForView(vertexPositionBatchMap.at(TPC_VIEW_V), slidingFitDataBatchMap.at(TPC_VIEW_V), energyKickV);
+    this->GetEnergyKicksForView(vertexPositionBatchMap.at(TPC_VIEW_W), slidingFitDataBatchMap.at(TPC_VIEW_W), energyKickW);
+
+    for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+    {
+        float energyKick(0.f);
+        energyKick += energyKickU[iVertex];
+        energyKick += energyKickV[iVertex];
+        energyKick += energyKickW[iVertex];
+        featureVector.push_back(energyKick);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float EnergyKickFeatureTool::GetEnergyKickForView(const CartesianVector &vertexPosition2D,
     const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const
 {
@@ -84,6 +110,68 @@ float EnergyKickFeatureTool::GetEnergyKickForView(const CartesianVector &vertexP
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EnergyKickFeatureTool::GetEnergyKicksForView(const VertexSelectionBaseAlgorithm::VertexPositionBatch &vertexPositionBatch,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, FloatVector &energyKickVector) const
+{
+    const unsigned int nVertices(vertexPositionBatch.GetNVertices());
+    const float *const pVertexX(vertexPositionBatch.m_positionX.data());
+    const float *const pVertexZ(vertexPositionBatch.m_positionZ.data());
+
+    unsigned int totHits(0);
+    bool useEnergy(true);
+    float totEnergy(0.f);
+    FloatVector totEnergyKick(nVertices, 0.f), totHitKick(nVertices, 0.f);
+
+    // ATTN Arithmetic mirrors GetEnergyKickForView and IncrementEnergyKickParameters exactly, for identical per-vertex results
+    for (unsigned int iCluster = 0; iCluster < slidingFitDataBatch.GetNClusters(); ++iCluster)
+    {
+        const float clusterEnergy(slidingFitDataBatch.m_clusterEnergy[iCluster]);
+        const float clusterNHits(slidingFitDataBatch.m_clusterNHits[iCluster]);
+
+        if (clusterEnergy < std::numeric_limits<float>::epsilon())
+            useEnergy = false;
+
+        totEnergy += clusterEnergy;
+        totHits += slidingFitDataBatch.m_clusterVector[iCluster]->GetNCaloHits();
+
+        const float minX(slidingFitDataBatch.m_minLayerPositionX[iCluster]), minZ(slidingFitDataBatch.m_minLayerPositionZ[iCluster]);
+        const float maxX(slidingFitDataBatch.m_maxLayerPositionX[iCluster]), maxZ(slidingFitDataBatch.m_maxLayerPositionZ[iCluster]);
+        const float minDirX(slidingFitDataBatch.m_minLayerDirectionX[iCluster]), minDirZ(slidingFitDataBatch.m_minLayerDirectionZ[iCluster]);
+        const float maxDirX(slidingFitDataBatch.m_maxLayerDirectionX[iCluster]), maxDirZ(slidingFitDataBatch.m_maxLayerDirectionZ[iCluster]);
+
+        for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+        {
+            const float toMinX(minX - pVertexX[iVertex]), toMinZ(minZ - pVertexZ[iVertex]);
+            const float toMaxX(maxX - pVertexX[iVertex]), toMaxZ(maxZ - pVertexZ[iVertex]);
+
+            const bool minLayerClosest((toMinX * toMinX + toMinZ * toMinZ) < (toMaxX * toMaxX + toMaxZ * toMaxZ));
+            const float displacementX(minLayerClosest ? toMinX : toMaxX), displacementZ(minLayerClosest ? toMinZ : toMaxZ);
+            const float directionX(minLayerClosest ? minDirX : maxDirX), directionZ(minLayerClosest ? minDirZ : maxDirZ);
+
+            const float crossProduct(displacementZ * directionX - displacementX * directionZ);
+            const float impactParameter(std::sqrt(crossProduct * crossProduct));
+            const float displacement(std::sqrt(displacementX * displacementX + displacementZ * displacementZ));
+
+            totEnergyKick[iVertex] += clusterEnergy * (impactParameter + m_xOffset) / (displacement + m_rOffset);
+            totHitKick[iVertex] += clusterNHits * (impactParameter + m_xOffset) / (displacement + m_rOffset);
+        }
+    }
+
+    for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+    {
+        float energyKick(0.f);
+        if (useEnergy && totEnergy > std::numeric_limits<float>::epsilon())
+            energyKick = totEnergyKick[iVertex] / totEnergy;
+
+        else if (!useEnergy && totHits > 0)
+            energyKick = totHitKick[iVertex] / static_cast<float>(totHits);
+
+        energyKickVector[iVertex] = energyKick;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void EnergyKickFeatureTool::IncrementEnergyKickParameters(const Cluster *const pCluster, const CartesianVector &clusterDisplacement,
     const CartesianVector &clusterDirection, float &totEnergyKick, float &totEnergy, float &totHitKick, unsigned int &totHits) const
 {
@@ -16,7 +16,7 @@ namespace lar_content
 /**
  *  @brief  EnergyKickFeatureTool class
  */
-class EnergyKickFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool
+class EnergyKickFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool, public VertexSelectionBaseAlgorithm::BatchVertexFeatureTool
 {
 public:
     /**
@@ -37,6 +37,18 @@ public:
         const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap, const VertexSelectionBaseAlgorithm::ClusterListMap &,
         const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float, float &);
 
+    /**
+     *  @brief  Run the tool for all vertex candidates
+     *
+     *  @param  featureVector the vector of features to append, receiving one energy kick feature per vertex
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexPositionBatchMap map of the projected vertex position batches
+     *  @param  slidingFitDataBatchMap map of the sliding fit data batches
+     */
+    void RunBatch(SupportVectorMachine::DoubleVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+        const VertexSelectionBaseAlgorithm::VertexPositionBatchMap &vertexPositionBatchMap,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataBatchMap &slidingFitDataBatchMap, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &);
+
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -50,6 +62,16 @@ private:
      */
     float GetEnergyKickForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const;
 
+    /**
+     *  @brief  Get the energy kick features for all vertex candidates in a given view, in a single pass over the clusters
+     *
+     *  @param  vertexPositionBatch the projections of the vertex positions in this view
+     *  @param  slidingFitDataBatch the sliding fit data batch in this view
+     *  @param  energyKickVector to receive the energy kick features, one per vertex
+     */
+    void GetEnergyKicksForView(const VertexSelectionBaseAlgorithm::VertexPositionBatch &vertexPositionBatch,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, pandora::FloatVector &energyKickVector) const;
+
     /**
      *  @brief  Increment the energy kick parameters for a given cluster
      *
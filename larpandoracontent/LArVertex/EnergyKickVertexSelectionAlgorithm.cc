@@ -45,6 +45,35 @@ void EnergyKickVertexSelectionAlgorithm::GetVertexScoreList(const VertexVector &
                                                       {TPC_VIEW_V, slidingFitDataListV},
                                                       {TPC_VIEW_W, slidingFitDataListW}};
 
+    if (this->IsBatchFeatureEvaluationOn())
+    {
+        VertexPositionBatchMap vertexPositionBatchMap;
+        SlidingFitDataBatchMap slidingFitDataBatchMap;
+        this->GetFeatureBatchMaps(vertexVector, slidingFitDataListMap, vertexPositionBatchMap, slidingFitDataBatchMap);
+
+        FloatVector beamDeweightingVector;
+        for (const Vertex *const pVertex : vertexVector)
+            beamDeweightingVector.push_back(this->IsBeamModeOn() ? this->GetBeamDeweightingScore(beamConstants, pVertex) : 0.f);
+
+        const SupportVectorMachine::DoubleVector energyKickVector(this->CalculateBatchFeaturesOfType<EnergyKickFeatureTool>(m_featureToolVector,
+            vertexVector, vertexPositionBatchMap, slidingFitDataBatchMap, slidingFitDataListMap, ClusterListMap(), KDTreeMap(), ShowerClusterListMap(),
+            beamDeweightingVector));
+
+        const SupportVectorMachine::DoubleVector energyAsymmetryVector(this->CalculateBatchFeaturesOfType<LocalAsymmetryFeatureTool>(m_featureToolVector,
+            vertexVector, vertexPositionBatchMap, slidingFitDataBatchMap, slidingFitDataListMap, ClusterListMap(), KDTreeMap(), ShowerClusterListMap(),
+            beamDeweightingVector));
+
+        for (unsigned int iVertex = 0; iVertex < vertexVector.size(); ++iVertex)
+        {
+            const float energyKickScore(-static_cast<float>(energyKickVector.at(iVertex)) / m_epsilon);
+            const float energyAsymmetryScore(static_cast<float>(energyAsymmetryVector.at(iVertex)) / m_asymmetryConstant);
+
+            vertexScoreList.push_back(VertexScore(vertexVector.at(iVertex), beamDeweightingVector.at(iVertex) + energyKickScore + energyAsymmetryScore));
+        }
+
+        return;
+    }
+
     float bestFastScore(0.f); // not actually used - artefact of toolizing RPhi score and still using performance trick
     for (const Vertex *const pVertex : vertexVector)
     {
@@ -46,6 +46,32 @@ void GlobalAsymmetryFeatureTool::Run(SupportVectorMachine::DoubleVector &feature
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void GlobalAsymmetryFeatureTool::RunBatch(SupportVectorMachine::DoubleVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+    const VertexSelectionBaseAlgorithm::VertexPositionBatchMap &vertexPositionBatchMap,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataBatchMap &slidingFitDataBatchMap, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &)
+{
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+       std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    const unsigned int nVertices(vertexPositionBatchMap.at(TPC_VIEW_U).GetNVertices());
+    FloatVector globalAsymmetryU(nVertices, 0.f), globalAsymmetryV(nVertices, 0.f), globalAsymmetryW(nVertices, 0.f);
+
+    this->GetGlobalAsymmetriesForView(vertexPositionBatchMap.at(TPC_VIEW_U), slidingFitDataBatchMap.at(TPC_VIEW_U), globalAsymmetryU);
+    this->GetGlobalAsymmetriesForView(vertexPositionBatchMap.at(TPC_VIEW_V), slidingFitDataBatchMap.at(TPC_VIEW_V), globalAsymmetryV);
+    this->GetGlobalAsymmetriesForView(vertexPositionBatchMap.at(TPC_VIEW_W), slidingFitDataBatchMap.at(TPC_VIEW_W), globalAsymmetryW);
+
+    for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+    {
+        float globalAsymmetry(0.f);
+        globalAsymmetry += globalAsymmetryU[iVertex];
+        globalAsymmetry += globalAsymmetryV[iVertex];
+        globalAsymmetry += globalAsymmetryW[iVertex];
+        featureVector.push_back(globalAsymmetry);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float GlobalAsymmetryFeatureTool::GetGlobalAsymmetryForView(const CartesianVector &vertexPosition2D,
     const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const
 {
@@ -82,6 +108,61 @@ float GlobalAsymmetryFeatureTool::GetGlobalAsymmetryForView(const CartesianVecto
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void GlobalAsymmetryFeatureTool::GetGlobalAsymmetriesForView(const VertexSelectionBaseAlgorithm::VertexPositionBatch &vertexPositionBatch,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, FloatVector &globalAsymmetryVector) const
+{
+    const unsigned int nVertices(vertexPositionBatch.GetNVertices());
+
+    bool useEnergy(true);
+    CartesianPointVector energyWeightedDirectionSums(nVertices, CartesianVector(0.f, 0.f, 0.f));
+    CartesianPointVector hitWeightedDirectionSums(nVertices, CartesianVector(0.f, 0.f, 0.f));
+
+    // ATTN Clusters are visited in sliding fit data list order for every vertex, so per-vertex results match GetGlobalAsymmetryForView
+    for (unsigned int iCluster = 0; iCluster < slidingFitDataBatch.GetNClusters(); ++iCluster)
+    {
+        const float clusterEnergy(slidingFitDataBatch.m_clusterEnergy[iCluster]);
+
+        if (clusterEnergy < std::numeric_limits<float>::epsilon())
+            useEnergy = false;
+
+        const float minX(slidingFitDataBatch.m_minLayerPositionX[iCluster]), minZ(slidingFitDataBatch.m_minLayerPositionZ[iCluster]);
+        const float maxX(slidingFitDataBatch.m_maxLayerPositionX[iCluster]), maxZ(slidingFitDataBatch.m_maxLayerPositionZ[iCluster]);
+        const CartesianVector minLayerDirection(slidingFitDataBatch.m_minLayerDirectionX[iCluster], 0.f, slidingFitDataBatch.m_minLayerDirectionZ[iCluster]);
+        const CartesianVector maxLayerDirection(slidingFitDataBatch.m_maxLayerDirectionX[iCluster], 0.f, slidingFitDataBatch.m_maxLayerDirectionZ[iCluster]);
+
+        for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+        {
+            const float vertexX(vertexPositionBatch.m_positionX[iVertex]), vertexZ(vertexPositionBatch.m_positionZ[iVertex]);
+
+            if (slidingFitDataBatch.GetClosestDistance(iCluster, vertexX, vertexZ) >= m_maxAsymmetryDistance)
+                continue;
+
+            const float toMinX(minX - vertexX), toMinZ(minZ - vertexZ), toMaxX(maxX - vertexX), toMaxZ(maxZ - vertexZ);
+            const bool minLayerClosest((toMinX * toMinX + toMinZ * toMinZ) < (toMaxX * toMaxX + toMaxZ * toMaxZ));
+            const CartesianVector &clusterDirection(minLayerClosest ? minLayerDirection : maxLayerDirection);
+
+            this->IncrementAsymmetryParameters(clusterEnergy, clusterDirection, energyWeightedDirectionSums[iVertex]);
+            this->IncrementAsymmetryParameters(slidingFitDataBatch.m_clusterNHits[iCluster], clusterDirection, hitWeightedDirectionSums[iVertex]);
+        }
+    }
+
+    for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+    {
+        const CartesianVector &localWeightedDirectionSum(useEnergy ? energyWeightedDirectionSums[iVertex] : hitWeightedDirectionSums[iVertex]);
+
+        if (localWeightedDirectionSum.GetMagnitudeSquared() < std::numeric_limits<float>::epsilon())
+        {
+            globalAsymmetryVector[iVertex] = 0.f;
+            continue;
+        }
+
+        const CartesianVector vertexPosition2D(vertexPositionBatch.m_positionX[iVertex], 0.f, vertexPositionBatch.m_positionZ[iVertex]);
+        globalAsymmetryVector[iVertex] = this->CalculateGlobalAsymmetry(useEnergy, vertexPosition2D, slidingFitDataBatch, localWeightedDirectionSum);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void GlobalAsymmetryFeatureTool::IncrementAsymmetryParameters(const float weight, const CartesianVector &clusterDirection,
     CartesianVector &localWeightedDirectionSum) const
 {
@@ -150,6 +231,50 @@ float GlobalAsymmetryFeatureTool::CalculateGlobalAsymmetry(const bool useEnergyM
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float GlobalAsymmetryFeatureTool::CalculateGlobalAsymmetry(const bool useEnergyMetrics, const CartesianVector &vertexPosition2D,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, const CartesianVector &localWeightedDirectionSum) const
+{
+    // Project every hit onto local event axis direction and record side of the projected vtx position on which it falls
+    float beforeVtxHitEnergy(0.f), afterVtxHitEnergy(0.f);
+    unsigned int beforeVtxHitCount(0), afterVtxHitCount(0);
+
+    const CartesianVector localWeightedDirection(localWeightedDirectionSum.GetUnitVector());
+    const float evtProjectedVtxPos(vertexPosition2D.GetDotProduct(localWeightedDirection));
+    const float directionX(localWeightedDirection.GetX()), directionZ(localWeightedDirection.GetZ());
+
+    // ATTN The batch hits of all clusters are contiguous, already sorted by position within each cluster
+    const unsigned int nHits(slidingFitDataBatch.m_hitPositionX.size());
+
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+    {
+        if (slidingFitDataBatch.m_hitPositionX[iHit] * directionX + slidingFitDataBatch.m_hitPositionZ[iHit] * directionZ < evtProjectedVtxPos)
+        {
+            beforeVtxHitEnergy += slidingFitDataBatch.m_hitEnergy[iHit];
+            ++beforeVtxHitCount;
+        }
+
+        else
+        {
+            afterVtxHitEnergy += slidingFitDataBatch.m_hitEnergy[iHit];
+            ++afterVtxHitCount;
+        }
+    }
+
+    // Use energy metrics if possible, otherwise fall back on hit counting.
+    const float totHitEnergy(beforeVtxHitEnergy + afterVtxHitEnergy);
+    const unsigned int totHitCount(beforeVtxHitCount + afterVtxHitCount);
+
+    if (useEnergyMetrics)
+        return std::fabs((afterVtxHitEnergy - beforeVtxHitEnergy)) / totHitEnergy;
+
+    if (0 == totHitCount)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    return std::fabs((static_cast<float>(afterVtxHitCount) - static_cast<float>(beforeVtxHitCount))) / static_cast<float>(totHitCount);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode GlobalAsymmetryFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
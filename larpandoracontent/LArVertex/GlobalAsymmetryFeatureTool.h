@@ -16,7 +16,7 @@ namespace lar_content
 /**
  *  @brief  GlobalAsymmetryFeatureTool class
  */
-class GlobalAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool
+class GlobalAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool, public VertexSelectionBaseAlgorithm::BatchVertexFeatureTool
 {
 public:
     /**
@@ -37,6 +37,18 @@ public:
         const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap, const VertexSelectionBaseAlgorithm::ClusterListMap &,
         const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float, float &);
 
+    /**
+     *  @brief  Run the tool for all vertex candidates
+     *
+     *  @param  featureVector the vector of features to append, receiving one global asymmetry feature per vertex
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexPositionBatchMap map of the projected vertex position batches
+     *  @param  slidingFitDataBatchMap map of the sliding fit data batches
+     */
+    void RunBatch(SupportVectorMachine::DoubleVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+        const VertexSelectionBaseAlgorithm::VertexPositionBatchMap &vertexPositionBatchMap,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataBatchMap &slidingFitDataBatchMap, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &);
+
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -50,6 +62,16 @@ private:
      */
     float GetGlobalAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const;
 
+    /**
+     *  @brief  Get the global asymmetry features for all vertex candidates in a given view, in a single pass over the clusters
+     *
+     *  @param  vertexPositionBatch the vertex positions projected into this view
+     *  @param  slidingFitDataBatch the sliding fit data batch for this view
+     *  @param  globalAsymmetryVector to receive the global asymmetry features, one per vertex
+     */
+    void GetGlobalAsymmetriesForView(const VertexSelectionBaseAlgorithm::VertexPositionBatch &vertexPositionBatch,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, pandora::FloatVector &globalAsymmetryVector) const;
+
     /**
      *  @brief  Increment the asymmetry parameters
      *
@@ -72,6 +94,19 @@ private:
     float CalculateGlobalAsymmetry(const bool useEnergyMetrics, const pandora::CartesianVector &vertexPosition2D,
         const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList, const pandora::CartesianVector &localWeightedDirectionSum) const;
 
+    /**
+     *  @brief  Calculate the global asymmetry feature, using the hits stored in a sliding fit data batch
+     *
+     *  @param  useEnergyMetrics whether to use energy-based metrics instead of hit-counting-based metrics
+     *  @param  vertexPosition2D the vertex position in this view
+     *  @param  slidingFitDataBatch the sliding fit data batch
+     *  @param  localWeightedDirectionSum the local event axis
+     *
+     *  @return the global asymmetry feature
+     */
+    float CalculateGlobalAsymmetry(const bool useEnergyMetrics, const pandora::CartesianVector &vertexPosition2D,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, const pandora::CartesianVector &localWeightedDirectionSum) const;
+
     float     m_maxAsymmetryDistance;    ///< The max distance between cluster (any hit) and vertex to calculate asymmetry score
 };
 
@@ -50,6 +50,32 @@ void LocalAsymmetryFeatureTool::Run(SupportVectorMachine::DoubleVector &featureV
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LocalAsymmetryFeatureTool::RunBatch(SupportVectorMachine::DoubleVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+    const VertexSelectionBaseAlgorithm::VertexPositionBatchMap &vertexPositionBatchMap,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataBatchMap &slidingFitDataBatchMap, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &)
+{
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+       std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    const unsigned int nVertices(vertexPositionBatchMap.at(TPC_VIEW_U).GetNVertices());
+    FloatVector localAsymmetryU(nVertices, 0.f), localAsymmetryV(nVertices, 0.f), localAsymmetryW(nVertices, 0.f);
+
+    this->GetLocalAsymmetriesForView(vertexPositionBatchMap.at(TPC_VIEW_U), slidingFitDataBatchMap.at(TPC_VIEW_U), localAsymmetryU);
+    this->GetLocalAsymmetriesForView(vertexPositionBatchMap.at(TPC_VIEW_V), slidingFitDataBatchMap.at(TPC_VIEW_V), localAsymmetryV);
+    this->GetLocalAsymmetriesForView(vertexPositionBatchMap.at(TPC_VIEW_W), slidingFitDataBatchMap.at(TPC_VIEW_W), localAsymmetryW);
+
+    for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+    {
+        float localAsymmetry(0.f);
+        localAsymmetry += localAsymmetryU[iVertex];
+        localAsymmetry += localAsymmetryV[iVertex];
+        localAsymmetry += localAsymmetryW[iVertex];
+        featureVector.push_back(localAsymmetry);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float LocalAsymmetryFeatureTool::GetLocalAsymmetryForView(const CartesianVector &vertexPosition2D,
     const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const
 {
@@ -91,6 +117,76 @@ float LocalAsymmetryFeatureTool::GetLocalAsymmetryForView(const CartesianVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LocalAsymmetryFeatureTool::GetLocalAsymmetriesForView(const VertexSelectionBaseAlgorithm::VertexPositionBatch &vertexPositionBatch,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, FloatVector &localAsymmetryVector) const
+{
+    const unsigned int nVertices(vertexPositionBatch.GetNVertices());
+
+    bool useEnergy(true);
+    std::vector<bool> useAsymmetry(nVertices, true);
+    CartesianPointVector energyWeightedDirectionSums(nVertices, CartesianVector(0.f, 0.f, 0.f));
+    CartesianPointVector hitWeightedDirectionSums(nVertices, CartesianVector(0.f, 0.f, 0.f));
+    std::vector<std::vector<unsigned int> > asymmetryClusterIndices(nVertices);
+
+    // ATTN Clusters are visited in sliding fit data list order for every vertex, so per-vertex results match GetLocalAsymmetryForView
+    for (unsigned int iCluster = 0; iCluster < slidingFitDataBatch.GetNClusters(); ++iCluster)
+    {
+        const float clusterEnergy(slidingFitDataBatch.m_clusterEnergy[iCluster]);
+
+        if (clusterEnergy < std::numeric_limits<float>::epsilon())
+            useEnergy = false;
+
+        const float minX(slidingFitDataBatch.m_minLayerPositionX[iCluster]), minZ(slidingFitDataBatch.m_minLayerPositionZ[iCluster]);
+        const float maxX(slidingFitDataBatch.m_maxLayerPositionX[iCluster]), maxZ(slidingFitDataBatch.m_maxLayerPositionZ[iCluster]);
+        const CartesianVector minLayerDirection(slidingFitDataBatch.m_minLayerDirectionX[iCluster], 0.f, slidingFitDataBatch.m_minLayerDirectionZ[iCluster]);
+        const CartesianVector maxLayerDirection(slidingFitDataBatch.m_maxLayerDirectionX[iCluster], 0.f, slidingFitDataBatch.m_maxLayerDirectionZ[iCluster]);
+
+        for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+        {
+            if (!useAsymmetry[iVertex])
+                continue;
+
+            const float vertexX(vertexPositionBatch.m_positionX[iVertex]), vertexZ(vertexPositionBatch.m_positionZ[iVertex]);
+
+            if (slidingFitDataBatch.GetClosestDistance(iCluster, vertexX, vertexZ) >= m_maxAsymmetryDistance)
+                continue;
+
+            const float toMinX(minX - vertexX), toMinZ(minZ - vertexZ), toMaxX(maxX - vertexX), toMaxZ(maxZ - vertexZ);
+            const bool minLayerClosest((toMinX * toMinX + toMinZ * toMinZ) < (toMaxX * toMaxX + toMaxZ * toMaxZ));
+            const CartesianVector &clusterDirection(minLayerClosest ? minLayerDirection : maxLayerDirection);
+
+            bool isViable(true);
+            isViable &= this->IncrementAsymmetryParameters(clusterEnergy, clusterDirection, energyWeightedDirectionSums[iVertex]);
+            isViable &= this->IncrementAsymmetryParameters(slidingFitDataBatch.m_clusterNHits[iCluster], clusterDirection, hitWeightedDirectionSums[iVertex]);
+            asymmetryClusterIndices[iVertex].push_back(iCluster);
+
+            if (!isViable)
+                useAsymmetry[iVertex] = false;
+        }
+    }
+
+    for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+    {
+        // Default: maximum asymmetry (i.e. not suppressed)
+        localAsymmetryVector[iVertex] = 1.f;
+
+        if (!useAsymmetry[iVertex])
+            continue;
+
+        const CartesianVector &energyWeightedDirectionSum(energyWeightedDirectionSums[iVertex]), &hitWeightedDirectionSum(hitWeightedDirectionSums[iVertex]);
+
+        if ((useEnergy && energyWeightedDirectionSum == CartesianVector(0.f, 0.f, 0.f)) || (!useEnergy && hitWeightedDirectionSum == CartesianVector(0.f, 0.f, 0.f)))
+            continue;
+
+        const CartesianVector vertexPosition2D(vertexPositionBatch.m_positionX[iVertex], 0.f, vertexPositionBatch.m_positionZ[iVertex]);
+        const CartesianVector &localWeightedDirectionSum(useEnergy ? energyWeightedDirectionSum : hitWeightedDirectionSum);
+        localAsymmetryVector[iVertex] = this->CalculateLocalAsymmetry(useEnergy, vertexPosition2D, slidingFitDataBatch, asymmetryClusterIndices[iVertex],
+            localWeightedDirectionSum);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool LocalAsymmetryFeatureTool::IncrementAsymmetryParameters(const float weight, const CartesianVector &clusterDirection,
     CartesianVector &localWeightedDirectionSum) const
 {
@@ -169,6 +265,54 @@ float LocalAsymmetryFeatureTool::CalculateLocalAsymmetry(const bool useEnergyMet
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float LocalAsymmetryFeatureTool::CalculateLocalAsymmetry(const bool useEnergyMetrics, const CartesianVector &vertexPosition2D,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, const std::vector<unsigned int> &asymmetryClusterIndices,
+    const CartesianVector &localWeightedDirectionSum) const
+{
+    if (asymmetryClusterIndices.empty() || (asymmetryClusterIndices.size() > m_maxAsymmetryNClusters))
+        return 1.f;
+
+    // Project every hit onto local event axis direction and record side of the projected vtx position on which it falls
+    float beforeVtxHitEnergy(0.f), afterVtxHitEnergy(0.f);
+    unsigned int beforeVtxHitCount(0), afterVtxHitCount(0);
+
+    const CartesianVector localWeightedDirection(localWeightedDirectionSum.GetUnitVector());
+    const float evtProjectedVtxPos(vertexPosition2D.GetDotProduct(localWeightedDirection));
+    const float directionX(localWeightedDirection.GetX()), directionZ(localWeightedDirection.GetZ());
+
+    for (const unsigned int iCluster : asymmetryClusterIndices)
+    {
+        for (unsigned int iHit = slidingFitDataBatch.m_hitOffsets[iCluster]; iHit < slidingFitDataBatch.m_hitOffsets[iCluster + 1]; ++iHit)
+        {
+            if (slidingFitDataBatch.m_hitPositionX[iHit] * directionX + slidingFitDataBatch.m_hitPositionZ[iHit] * directionZ < evtProjectedVtxPos)
+            {
+                beforeVtxHitEnergy += slidingFitDataBatch.m_hitEnergy[iHit];
+                ++beforeVtxHitCount;
+            }
+
+            else
+            {
+                afterVtxHitEnergy += slidingFitDataBatch.m_hitEnergy[iHit];
+                ++afterVtxHitCount;
+            }
+        }
+    }
+
+    // Use energy metrics if possible, otherwise fall back on hit counting.
+    const float totHitEnergy(afterVtxHitEnergy + beforeVtxHitEnergy);
+    const unsigned int totHitCount(beforeVtxHitCount + afterVtxHitCount);
+
+    if (useEnergyMetrics && (totHitEnergy > std::numeric_limits<float>::epsilon()))
+        return std::fabs((afterVtxHitEnergy - beforeVtxHitEnergy)) / totHitEnergy;
+
+    if (0 == totHitCount)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    return std::fabs((static_cast<float>(afterVtxHitCount) - static_cast<float>(beforeVtxHitCount))) / static_cast<float>(totHitCount);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode LocalAsymmetryFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
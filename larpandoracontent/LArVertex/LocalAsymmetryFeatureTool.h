@@ -16,7 +16,7 @@ namespace lar_content
 /**
  *  @brief  LocalAsymmetryFeatureTool class
  */
-class LocalAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool
+class LocalAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool, public VertexSelectionBaseAlgorithm::BatchVertexFeatureTool
 {
 public:
     /**
@@ -37,6 +37,18 @@ public:
         const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,const VertexSelectionBaseAlgorithm::ClusterListMap &,
         const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float, float &);
 
+    /**
+     *  @brief  Run the tool for all vertex candidates
+     *
+     *  @param  featureVector the vector of features to append, receiving one local asymmetry feature per vertex
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexPositionBatchMap map of the projected vertex position batches
+     *  @param  slidingFitDataBatchMap map of the sliding fit data batches
+     */
+    void RunBatch(SupportVectorMachine::DoubleVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+        const VertexSelectionBaseAlgorithm::VertexPositionBatchMap &vertexPositionBatchMap,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataBatchMap &slidingFitDataBatchMap, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &);
+
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -50,6 +62,16 @@ private:
      */
     float GetLocalAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const;
 
+    /**
+     *  @brief  Get the local asymmetry features for all vertex candidates in a given view, in a single pass over the clusters
+     *
+     *  @param  vertexPositionBatch the vertex positions projected into this view
+     *  @param  slidingFitDataBatch the sliding fit data batch in this view
+     *  @param  localAsymmetryVector to receive the local asymmetry features, one per vertex
+     */
+    void GetLocalAsymmetriesForView(const VertexSelectionBaseAlgorithm::VertexPositionBatch &vertexPositionBatch,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, pandora::FloatVector &localAsymmetryVector) const;
+
     /**
      *  @brief  Increment the asymmetry parameters
      *
@@ -75,6 +97,21 @@ private:
     float CalculateLocalAsymmetry(const bool useEnergyMetrics, const pandora::CartesianVector &vertexPosition2D,
         const pandora::ClusterVector &asymmetryClusters, const pandora::CartesianVector &localWeightedDirectionSum) const;
 
+    /**
+     *  @brief  Calculate the local asymmetry feature, using the hits stored in a sliding fit data batch
+     *
+     *  @param  useEnergyMetrics whether to use energy-based rather than hit-counting-based metrics
+     *  @param  vertexPosition2D the vertex position
+     *  @param  slidingFitDataBatch the sliding fit data batch
+     *  @param  asymmetryClusterIndices the batch indices of the clusters to use to calculate the asymmetry
+     *  @param  localWeightedDirectionSum the local event axis
+     *
+     *  @return the local asymmetry feature
+     */
+    float CalculateLocalAsymmetry(const bool useEnergyMetrics, const pandora::CartesianVector &vertexPosition2D,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataBatch &slidingFitDataBatch, const std::vector<unsigned int> &asymmetryClusterIndices,
+        const pandora::CartesianVector &localWeightedDirectionSum) const;
+
     float           m_maxAsymmetryDistance;     ///< The max distance between cluster (any hit) and vertex to calculate asymmetry score
     float           m_minAsymmetryCosAngle;     ///< The min opening angle cosine used to determine viability of asymmetry score
     unsigned int    m_maxAsymmetryNClusters;    ///< The max number of associated clusters to calculate the asymmetry
@@ -29,7 +29,9 @@ RPhiFeatureTool::RPhiFeatureTool() :
     m_fastHistogramNPhiBins(200),
     m_fastHistogramPhiMin(-1.1f * M_PI),
     m_fastHistogramPhiMax(+1.1f * M_PI),
-    m_enableFolding(true)
+    m_enableFolding(true),
+    m_binnedKernelEstimate(false),
+    m_kernelEstimateBinWidth(0.01f)
 {
 }
 
@@ -51,6 +53,13 @@ void RPhiFeatureTool::Run(SupportVectorMachine::DoubleVector &featureVector, con
     this->FillKernelEstimate(pVertex, TPC_VIEW_V, kdTreeMap.at(TPC_VIEW_V), kernelEstimateV);
     this->FillKernelEstimate(pVertex, TPC_VIEW_W, kdTreeMap.at(TPC_VIEW_W), kernelEstimateW);
 
+    if (m_binnedKernelEstimate && !m_fastScoreOnly)
+    {
+        kernelEstimateU.Bin(m_gaussianStencil, m_kernelEstimateBinWidth);
+        kernelEstimateV.Bin(m_gaussianStencil, m_kernelEstimateBinWidth);
+        kernelEstimateW.Bin(m_gaussianStencil, m_kernelEstimateBinWidth);
+    }
+
     const float expBeamDeweightingScore = std::exp(beamDeweightingScore);
 
     if (m_fastScoreCheck || m_fastScoreOnly)
@@ -212,11 +221,47 @@ float RPhiFeatureTool::atan2Fast(const float y, const float x) const
     return ((y < 0.f) ? -angle : angle); // negate if in quad III or IV
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::CalculateGaussianStencil()
+{
+    m_gaussianStencil.clear();
+
+    const int nHalfWidthBins(static_cast<int>(std::ceil(3.f * m_kernelEstimateSigma / m_kernelEstimateBinWidth)));
+    const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_kernelEstimateSigma * m_kernelEstimateSigma));
+
+    for (int iBin = -nHalfWidthBins; iBin <= nHalfWidthBins; ++iBin)
+    {
+        const float deltaSigma(static_cast<float>(iBin) * m_kernelEstimateBinWidth / m_kernelEstimateSigma);
+        m_gaussianStencil.push_back(gaussConstant * std::exp(-0.5f * deltaSigma * deltaSigma));
+    }
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 {
+    if (m_isBinned)
+    {
+        if (m_binnedDensity.empty())
+            return 0.f;
+
+        // Linear interpolation between the two nearest bin centres
+        const float binPosition((x - m_binnedXLow) / m_binWidth);
+        const int lowBin(static_cast<int>(std::floor(binPosition)));
+        const int nBins(static_cast<int>(m_binnedDensity.size()));
+
+        if ((lowBin < -1) || (lowBin >= nBins))
+            return 0.f;
+
+        const float highFraction(binPosition - static_cast<float>(lowBin));
+        const float lowContent((lowBin >= 0) ? m_binnedDensity[lowBin] : 0.f);
+        const float highContent((lowBin + 1 < nBins) ? m_binnedDensity[lowBin + 1] : 0.f);
+
+        return (1.f - highFraction) * lowContent + highFraction * highContent;
+    }
+
     const ContributionList &contributionList(this->GetContributionList());
     ContributionList::const_iterator lowerIter(contributionList.lower_bound(x - 3.f * m_sigma));
     ContributionList::const_iterator upperIter(contributionList.upper_bound(x + 3.f * m_sigma));
@@ -236,6 +281,53 @@ float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void RPhiFeatureTool::KernelEstimate::Bin(const FloatVector &gaussianStencil, const float binWidth)
+{
+    if ((binWidth < std::numeric_limits<float>::epsilon()) || (gaussianStencil.size() % 2 != 1))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    m_isBinned = true;
+    m_binWidth = binWidth;
+    m_binnedDensity.clear();
+
+    if (m_contributionList.empty())
+        return;
+
+    // Pad the range of the contributions by the stencil half-width, so that no part of the distribution is truncated
+    const int nHalfWidthBins(static_cast<int>(gaussianStencil.size() / 2));
+    const float xMin(m_contributionList.begin()->first), xMax(m_contributionList.rbegin()->first);
+    const int nContributionBins(static_cast<int>(std::ceil((xMax - xMin) / binWidth)) + 1);
+    const int nBins(nContributionBins + 2 * nHalfWidthBins + 1);
+    m_binnedXLow = xMin - static_cast<float>(nHalfWidthBins) * binWidth;
+
+    FloatVector histogram(nBins, 0.f);
+
+    for (const ContributionList::value_type &contribution : m_contributionList)
+    {
+        const float binPosition((contribution.first - m_binnedXLow) / binWidth);
+        const int lowBin(std::max(0, std::min(nBins - 2, static_cast<int>(std::floor(binPosition)))));
+        const float highFraction(binPosition - static_cast<float>(lowBin));
+
+        histogram[lowBin] += (1.f - highFraction) * contribution.second;
+        histogram[lowBin + 1] += highFraction * contribution.second;
+    }
+
+    m_binnedDensity.assign(nBins, 0.f);
+
+    for (int iBin = 0; iBin < nBins; ++iBin)
+    {
+        if (std::fabs(histogram[iBin]) < std::numeric_limits<float>::min())
+            continue;
+
+        const int minBin(std::max(0, iBin - nHalfWidthBins)), maxBin(std::min(nBins - 1, iBin + nHalfWidthBins));
+
+        for (int jBin = minBin; jBin <= maxBin; ++jBin)
+            m_binnedDensity[jBin] += histogram[iBin] * gaussianStencil[jBin - iBin + nHalfWidthBins];
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void RPhiFeatureTool::KernelEstimate::AddContribution(const float x, const float weight)
 {
     m_contributionList.insert(ContributionList::value_type(x, weight));
@@ -278,6 +370,24 @@ StatusCode RPhiFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "EnableFolding", m_enableFolding));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "BinnedKernelEstimate", m_binnedKernelEstimate));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "KernelEstimateBinWidth", m_kernelEstimateBinWidth));
+
+    if (m_binnedKernelEstimate)
+    {
+        if ((m_kernelEstimateSigma < std::numeric_limits<float>::epsilon()) || (m_kernelEstimateBinWidth < std::numeric_limits<float>::epsilon()))
+        {
+            std::cout << "RPhiFeatureTool: Invalid parameter(s), KernelEstimateSigma " << m_kernelEstimateSigma << ", KernelEstimateBinWidth "
+                      << m_kernelEstimateBinWidth << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        this->CalculateGaussianStencil();
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -65,6 +65,15 @@ private:
          */
         float Sample(const float x) const;
 
+        /**
+         *  @brief  Build a binned representation of the distribution: contributions are linearly assigned to a fixed-width histogram, which
+         *          is convolved once with a precomputed Gaussian stencil. Subsequent calls to Sample then interpolate the binned density.
+         *
+         *  @param  gaussianStencil the gaussian kernel, sampled at integer multiples of the bin width from -n to +n bins
+         *  @param  binWidth the bin width
+         */
+        void Bin(const pandora::FloatVector &gaussianStencil, const float binWidth);
+
         typedef std::multimap<float, float> ContributionList;   ///< Map from x coord to weight, ATTN avoid map.find, etc. with float key
 
         /**
@@ -92,6 +101,11 @@ private:
     private:
         ContributionList            m_contributionList;         ///< The contribution list
         const float                 m_sigma;                    ///< The assigned width
+
+        bool                        m_isBinned;                 ///< Whether a binned representation of the distribution has been built
+        float                       m_binnedXLow;               ///< The centre of the first bin of the binned distribution
+        float                       m_binWidth;                 ///< The bin width of the binned distribution
+        pandora::FloatVector        m_binnedDensity;            ///< The binned distribution, sampled at the bin centres
     };
 
     //--------------------------------------------------------------------------------------------------------------------------------------
@@ -161,6 +175,11 @@ private:
      */
     float atan2Fast(const float y, const float x) const;
 
+    /**
+     *  @brief  Precompute the gaussian stencil used to build binned kernel estimates
+     */
+    void CalculateGaussianStencil();
+
     bool            m_fastScoreCheck;               ///< Whether to use the fast histogram based score to selectively avoid calling full or midway scores
     bool            m_fastScoreOnly;                ///< Whether to use the fast histogram based score only
     bool            m_fullScore;                    ///< Whether to use the full kernel density estimation score, as opposed to the midway score
@@ -175,12 +194,19 @@ private:
     float           m_fastHistogramPhiMax;          ///< Max value for fast score histograms
 
     bool            m_enableFolding;                ///< Whether to enable folding of -pi -> +pi phi distribution into 0 -> +pi region only
+
+    bool            m_binnedKernelEstimate;         ///< Whether to sample binned kernel estimates, rather than summing over all contributions
+    float           m_kernelEstimateBinWidth;       ///< The bin width to use for binned kernel estimates
+    pandora::FloatVector m_gaussianStencil;         ///< The precomputed gaussian stencil for binned kernel estimates
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) :
-    m_sigma(sigma)
+    m_sigma(sigma),
+    m_isBinned(false),
+    m_binnedXLow(0.f),
+    m_binWidth(0.f)
 {
     if (m_sigma < std::numeric_limits<float>::epsilon())
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
@@ -46,6 +46,32 @@ void ShowerAsymmetryFeatureTool::Run(DoubleVector &featureVector, const VertexSe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ShowerAsymmetryFeatureTool::RunBatch(DoubleVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+    const VertexSelectionBaseAlgorithm::VertexPositionBatchMap &vertexPositionBatchMap, const VertexSelectionBaseAlgorithm::SlidingFitDataBatchMap &,
+    const VertexSelectionBaseAlgorithm::ShowerClusterListMap &showerClusterListMap)
+{
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+       std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    const unsigned int nVertices(vertexPositionBatchMap.at(TPC_VIEW_U).GetNVertices());
+    FloatVector showerAsymmetryU(nVertices, 1.f), showerAsymmetryV(nVertices, 1.f), showerAsymmetryW(nVertices, 1.f);
+
+    this->GetShowerAsymmetriesForView(vertexPositionBatchMap.at(TPC_VIEW_U), showerClusterListMap.at(TPC_VIEW_U), showerAsymmetryU);
+    this->GetShowerAsymmetriesForView(vertexPositionBatchMap.at(TPC_VIEW_V), showerClusterListMap.at(TPC_VIEW_V), showerAsymmetryV);
+    this->GetShowerAsymmetriesForView(vertexPositionBatchMap.at(TPC_VIEW_W), showerClusterListMap.at(TPC_VIEW_W), showerAsymmetryW);
+
+    for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+    {
+        float showerAsymmetry(0.f);
+        showerAsymmetry += showerAsymmetryU[iVertex];
+        showerAsymmetry += showerAsymmetryV[iVertex];
+        showerAsymmetry += showerAsymmetryW[iVertex];
+        featureVector.push_back(showerAsymmetry);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float ShowerAsymmetryFeatureTool::GetShowerAsymmetryForView(const CartesianVector &vertexPosition2D,
     const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList) const
 {
@@ -80,6 +106,92 @@ float ShowerAsymmetryFeatureTool::GetShowerAsymmetryForView(const CartesianVecto
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ShowerAsymmetryFeatureTool::GetShowerAsymmetriesForView(const VertexSelectionBaseAlgorithm::VertexPositionBatch &vertexPositionBatch,
+    const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList, FloatVector &showerAsymmetryVector) const
+{
+    const unsigned int nVertices(vertexPositionBatch.GetNVertices());
+    std::vector<bool> isResolved(nVertices, false);
+    unsigned int nResolved(0);
+
+    for (const VertexSelectionBaseAlgorithm::ShowerCluster &showerCluster : showerClusterList)
+    {
+        if (nResolved == nVertices)
+            break;
+
+        // Collect the shower hits once, in the summation order used by CalculateAsymmetryParameters
+        FloatVector hitPositionX, hitPositionZ, hitEnergy;
+
+        for (const Cluster * const pCluster : showerCluster.GetClusters())
+        {
+            CaloHitList caloHitList;
+            pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+            CaloHitVector caloHitVector(caloHitList.begin(), caloHitList.end());
+            std::sort(caloHitVector.begin(), caloHitVector.end(), LArClusterHelper::SortHitsByPosition);
+
+            for (const CaloHit *const pCaloHit : caloHitVector)
+            {
+                hitPositionX.push_back(pCaloHit->GetPositionVector().GetX());
+                hitPositionZ.push_back(pCaloHit->GetPositionVector().GetZ());
+                hitEnergy.push_back(pCaloHit->GetElectromagneticEnergy());
+            }
+        }
+
+        const unsigned int nHits(hitPositionX.size());
+        const TwoDSlidingFitResult &showerFit = showerCluster.GetFit();
+
+        for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex)
+        {
+            if (isResolved[iVertex])
+                continue;
+
+            const float vertexX(vertexPositionBatch.m_positionX[iVertex]), vertexZ(vertexPositionBatch.m_positionZ[iVertex]);
+            float closestDistanceSquared(std::numeric_limits<float>::max());
+
+            for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+            {
+                const float deltaX(hitPositionX[iHit] - vertexX), deltaZ(hitPositionZ[iHit] - vertexZ);
+                closestDistanceSquared = std::min(closestDistanceSquared, deltaX * deltaX + deltaZ * deltaZ);
+            }
+
+            if ((0 == nHits) || (std::sqrt(closestDistanceSquared) >= m_vertexClusterDistance))
+                continue;
+
+            isResolved[iVertex] = true;
+            ++nResolved;
+
+            const CartesianVector vertexPosition2D(vertexX, 0.f, vertexZ);
+
+            float rL(0.f), rT(0.f);
+            showerFit.GetLocalPosition(vertexPosition2D, rL, rT);
+
+            CartesianVector showerDirection(0.f, 0.f, 0.f);
+            showerFit.GetGlobalFitDirection(rL, showerDirection);
+
+            const float projectedVtxPosition = vertexPosition2D.GetDotProduct(showerDirection);
+            const float directionX(showerDirection.GetX()), directionZ(showerDirection.GetZ());
+
+            float beforeVtxEnergy(0.f), afterVtxEnergy(0.f);
+
+            for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+            {
+                const float projectedHitPosition(hitPositionX[iHit] * directionX + hitPositionZ[iHit] * directionZ);
+
+                if (projectedHitPosition < projectedVtxPosition)
+                    beforeVtxEnergy += hitEnergy[iHit];
+
+                else if (projectedHitPosition > projectedVtxPosition)
+                    afterVtxEnergy += hitEnergy[iHit];
+            }
+
+            if (beforeVtxEnergy + afterVtxEnergy > 0.f)
+                showerAsymmetryVector[iVertex] = std::fabs(afterVtxEnergy - beforeVtxEnergy) / (afterVtxEnergy + beforeVtxEnergy);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool ShowerAsymmetryFeatureTool::ShouldUseShowerCluster(const CartesianVector &vertexPosition,
     const VertexSelectionBaseAlgorithm::ShowerCluster &showerCluster) const
 {
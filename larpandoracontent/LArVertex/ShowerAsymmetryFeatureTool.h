@@ -18,7 +18,7 @@ namespace lar_content
 /**
  *  @brief  ShowerAsymmetryFeatureTool class
  */
-class ShowerAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool
+class ShowerAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool, public VertexSelectionBaseAlgorithm::BatchVertexFeatureTool
 {
 public:
     /**
@@ -40,6 +40,18 @@ public:
         const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &showerClusterListMap,
         const float, float &);
 
+    /**
+     *  @brief  Run the tool for all vertex candidates
+     *
+     *  @param  featureVector the vector of features to append, receiving one shower asymmetry feature per vertex
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexPositionBatchMap map of the projected vertex position batches
+     *  @param  showerClusterListMap map of the shower cluster lists
+     */
+    void RunBatch(DoubleVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+        const VertexSelectionBaseAlgorithm::VertexPositionBatchMap &vertexPositionBatchMap, const VertexSelectionBaseAlgorithm::SlidingFitDataBatchMap &,
+        const VertexSelectionBaseAlgorithm::ShowerClusterListMap &showerClusterListMap);
+
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -53,6 +65,16 @@ private:
      */
     float GetShowerAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList) const;
 
+    /**
+     *  @brief  Get the shower asymmetry features for all vertex candidates in a given view, in a single pass over the shower clusters
+     *
+     *  @param  vertexPositionBatch the projected vertex positions
+     *  @param  showerClusterList the list of shower clusters in this view
+     *  @param  showerAsymmetryVector to receive the shower asymmetry features, one per vertex
+     */
+    void GetShowerAsymmetriesForView(const VertexSelectionBaseAlgorithm::VertexPositionBatch &vertexPositionBatch,
+        const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList, pandora::FloatVector &showerAsymmetryVector) const;
+
     /**
      *  @brief  Get whether we should use a given shower cluster for asymmetry calculation
      *
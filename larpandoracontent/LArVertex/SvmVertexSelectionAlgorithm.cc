@@ -103,11 +103,20 @@ void SvmVertexSelectionAlgorithm::GetVertexScoreList(const VertexVector &vertexV
     this->AddEventFeaturesToVector(eventFeatureInfo, eventFeatureList);
 
     VertexFeatureInfoMap vertexFeatureInfoMap;
-    for (const Vertex *const pVertex : vertexVector)
+
+    if (this->IsBatchFeatureEvaluationOn())
     {
-        this->PopulateVertexFeatureInfoMap(beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex,
+        this->PopulateVertexFeatureInfoMap(beamConstants, vertexVector, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap,
             vertexFeatureInfoMap);
     }
+    else
+    {
+        for (const Vertex *const pVertex : vertexVector)
+        {
+            this->PopulateVertexFeatureInfoMap(beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex,
+                vertexFeatureInfoMap);
+        }
+    }
 
     // Use a simple score to get the list of vertices representing good regions.
     VertexScoreList initialScoreList;
@@ -477,6 +486,43 @@ void SvmVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamConstan
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void SvmVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const VertexVector &vertexVector,
+    const ClusterListMap &clusterListMap, const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap,
+    const KDTreeMap &kdTreeMap, VertexFeatureInfoMap &vertexFeatureInfoMap) const
+{
+    VertexPositionBatchMap vertexPositionBatchMap;
+    SlidingFitDataBatchMap slidingFitDataBatchMap;
+    this->GetFeatureBatchMaps(vertexVector, slidingFitDataListMap, vertexPositionBatchMap, slidingFitDataBatchMap);
+
+    FloatVector beamDeweightingVector;
+    for (const Vertex *const pVertex : vertexVector)
+        beamDeweightingVector.push_back(this->GetBeamDeweightingScore(beamConstants, pVertex));
+
+    const SupportVectorMachine::DoubleVector energyKickVector(this->CalculateBatchFeaturesOfType<EnergyKickFeatureTool>(m_featureToolVector, vertexVector,
+        vertexPositionBatchMap, slidingFitDataBatchMap, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweightingVector));
+
+    const SupportVectorMachine::DoubleVector localAsymmetryVector(this->CalculateBatchFeaturesOfType<LocalAsymmetryFeatureTool>(m_featureToolVector,
+        vertexVector, vertexPositionBatchMap, slidingFitDataBatchMap, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap,
+        beamDeweightingVector));
+
+    const SupportVectorMachine::DoubleVector globalAsymmetryVector(this->CalculateBatchFeaturesOfType<GlobalAsymmetryFeatureTool>(m_featureToolVector,
+        vertexVector, vertexPositionBatchMap, slidingFitDataBatchMap, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap,
+        beamDeweightingVector));
+
+    const SupportVectorMachine::DoubleVector showerAsymmetryVector(this->CalculateBatchFeaturesOfType<ShowerAsymmetryFeatureTool>(m_featureToolVector,
+        vertexVector, vertexPositionBatchMap, slidingFitDataBatchMap, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap,
+        beamDeweightingVector));
+
+    for (unsigned int iVertex = 0; iVertex < vertexVector.size(); ++iVertex)
+    {
+        VertexFeatureInfo vertexFeatureInfo(beamDeweightingVector.at(iVertex), 0.f, energyKickVector.at(iVertex), localAsymmetryVector.at(iVertex),
+            globalAsymmetryVector.at(iVertex), showerAsymmetryVector.at(iVertex));
+        vertexFeatureInfoMap.emplace(vertexVector.at(iVertex), vertexFeatureInfo);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void SvmVertexSelectionAlgorithm::PopulateInitialScoreList(VertexFeatureInfoMap &vertexFeatureInfoMap, const Vertex *const pVertex,
                                                            VertexScoreList &initialScoreList) const
 {
@@ -268,6 +268,21 @@ private:
         const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
         const pandora::Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
 
+    /**
+     *  @brief  Populate the vertex feature info map for all vertices, evaluating each feature for all candidates in one pass over the clusters
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  vertexVector the vertex vector
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  vertexFeatureInfoMap the map to populate
+     */
+    void PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const pandora::VertexVector &vertexVector, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        VertexFeatureInfoMap &vertexFeatureInfoMap) const;
+
     /**
      *  @brief  Populate the initial vertex score list for a given vertex
      *
@@ -31,7 +31,9 @@ VertexSelectionBaseAlgorithm::VertexSelectionBaseAlgorithm() :
     m_useDetectorGaps(true),
     m_gapTolerance(0.f),
     m_isEmptyViewAcceptable(true),
-    m_minVertexAcceptableViews(3)
+    m_minVertexAcceptableViews(3),
+    m_batchFeatureEvaluation(false),
+    m_detectorGapIndex(DetectorGapList())
 {
 }
 
@@ -137,6 +139,18 @@ void VertexSelectionBaseAlgorithm::CalculateClusterSlidingFits(const ClusterList
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void VertexSelectionBaseAlgorithm::GetFeatureBatchMaps(const VertexVector &vertexVector, const SlidingFitDataListMap &slidingFitDataListMap,
+    VertexPositionBatchMap &vertexPositionBatchMap, SlidingFitDataBatchMap &slidingFitDataBatchMap) const
+{
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+    {
+        (void) vertexPositionBatchMap.emplace(hitType, VertexPositionBatch(this->GetPandora(), vertexVector, hitType));
+        (void) slidingFitDataBatchMap.emplace(hitType, SlidingFitDataBatch(slidingFitDataListMap.at(hitType)));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode VertexSelectionBaseAlgorithm::Run()
 {
     const VertexList *pInputVertexList(NULL);
@@ -150,6 +164,9 @@ StatusCode VertexSelectionBaseAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    if (m_useDetectorGaps)
+        m_detectorGapIndex = LArGeometryHelper::DetectorGapIndex(this->GetPandora().GetGeometry()->GetDetectorGapList());
+
     HitKDTree2D kdTreeU, kdTreeV, kdTreeW;
     this->InitializeKDTrees(kdTreeU, kdTreeV, kdTreeW);
 
@@ -232,7 +249,8 @@ bool VertexSelectionBaseAlgorithm::IsVertexInGap(const Vertex *const pVertex, co
     if (!m_useDetectorGaps)
         return false;
 
-    return LArGeometryHelper::IsInGap3D(this->GetPandora(), pVertex->GetPosition(), hitType, m_gapTolerance);
+    const CartesianVector testPoint2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType));
+    return m_detectorGapIndex.IsInGap(testPoint2D, hitType, m_gapTolerance);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -343,6 +361,82 @@ pandora::CartesianPointVector VertexSelectionBaseAlgorithm::ShowerCluster::GetCl
     return coordinateVector;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+VertexSelectionBaseAlgorithm::SlidingFitDataBatch::SlidingFitDataBatch(const SlidingFitDataList &slidingFitDataList)
+{
+    m_hitOffsets.push_back(0);
+
+    for (const SlidingFitData &slidingFitData : slidingFitDataList)
+    {
+        const Cluster *const pCluster(slidingFitData.GetCluster());
+
+        m_clusterVector.push_back(pCluster);
+        m_clusterEnergy.push_back(pCluster->GetElectromagneticEnergy());
+        m_clusterNHits.push_back(static_cast<float>(pCluster->GetNCaloHits()));
+        m_minLayerPositionX.push_back(slidingFitData.GetMinLayerPosition().GetX());
+        m_minLayerPositionZ.push_back(slidingFitData.GetMinLayerPosition().GetZ());
+        m_maxLayerPositionX.push_back(slidingFitData.GetMaxLayerPosition().GetX());
+        m_maxLayerPositionZ.push_back(slidingFitData.GetMaxLayerPosition().GetZ());
+        m_minLayerDirectionX.push_back(slidingFitData.GetMinLayerDirection().GetX());
+        m_minLayerDirectionZ.push_back(slidingFitData.GetMinLayerDirection().GetZ());
+        m_maxLayerDirectionX.push_back(slidingFitData.GetMaxLayerDirection().GetX());
+        m_maxLayerDirectionZ.push_back(slidingFitData.GetMaxLayerDirection().GetZ());
+
+        // ATTN Sort once here, so that summations over the hits in the feature tools proceed in a reproducible order
+        CaloHitList caloHitList;
+        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+        CaloHitVector caloHitVector(caloHitList.begin(), caloHitList.end());
+        std::sort(caloHitVector.begin(), caloHitVector.end(), LArClusterHelper::SortHitsByPosition);
+
+        for (const CaloHit *const pCaloHit : caloHitVector)
+        {
+            m_hitPositionX.push_back(pCaloHit->GetPositionVector().GetX());
+            m_hitPositionZ.push_back(pCaloHit->GetPositionVector().GetZ());
+            m_hitEnergy.push_back(pCaloHit->GetElectromagneticEnergy());
+        }
+
+        m_hitOffsets.push_back(m_hitPositionX.size());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float VertexSelectionBaseAlgorithm::SlidingFitDataBatch::GetClosestDistance(const unsigned int clusterIndex, const float positionX,
+    const float positionZ) const
+{
+    const unsigned int hitBegin(m_hitOffsets.at(clusterIndex)), hitEnd(m_hitOffsets.at(clusterIndex + 1));
+
+    if (hitBegin == hitEnd)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    float closestDistanceSquared(std::numeric_limits<float>::max());
+
+    for (unsigned int iHit = hitBegin; iHit < hitEnd; ++iHit)
+    {
+        const float deltaX(m_hitPositionX[iHit] - positionX), deltaZ(m_hitPositionZ[iHit] - positionZ);
+        closestDistanceSquared = std::min(closestDistanceSquared, deltaX * deltaX + deltaZ * deltaZ);
+    }
+
+    return std::sqrt(closestDistanceSquared);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+VertexSelectionBaseAlgorithm::VertexPositionBatch::VertexPositionBatch(const Pandora &pandora, const VertexVector &vertexVector, const HitType hitType)
+{
+    m_positionX.reserve(vertexVector.size());
+    m_positionZ.reserve(vertexVector.size());
+
+    for (const Vertex *const pVertex : vertexVector)
+    {
+        const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(pandora, pVertex->GetPosition(), hitType));
+        m_positionX.push_back(vertexPosition2D.GetX());
+        m_positionZ.push_back(vertexPosition2D.GetZ());
+    }
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -390,6 +484,9 @@ StatusCode VertexSelectionBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "MinVertexAcceptableViews", m_minVertexAcceptableViews));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "BatchFeatureEvaluation", m_batchFeatureEvaluation));
+
     return STATUS_CODE_SUCCESS;
 }
 
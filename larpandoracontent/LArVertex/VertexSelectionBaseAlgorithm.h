@@ -10,6 +10,7 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArSvmHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
@@ -216,6 +217,80 @@ public:
 
     typedef std::vector<ShowerCluster> ShowerClusterList;
 
+    /**
+     *  @brief Sliding fit data batch class, a structure-of-arrays copy of a sliding fit data list and the hits of its clusters
+     */
+    class SlidingFitDataBatch
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  slidingFitDataList the sliding fit data list
+         */
+        SlidingFitDataBatch(const SlidingFitDataList &slidingFitDataList);
+
+        /**
+         *  @brief  Get the number of clusters in the batch
+         *
+         *  @return the number of clusters
+         */
+        unsigned int GetNClusters() const;
+
+        /**
+         *  @brief  Get the closest distance between a 2D position and the hits of a cluster in the batch
+         *
+         *  @param  clusterIndex the index of the cluster in the batch
+         *  @param  positionX the x coordinate of the position
+         *  @param  positionZ the z coordinate of the position
+         *
+         *  @return the closest distance
+         */
+        float GetClosestDistance(const unsigned int clusterIndex, const float positionX, const float positionZ) const;
+
+        pandora::ClusterVector      m_clusterVector;            ///< The clusters, in sliding fit data list order
+        pandora::FloatVector        m_clusterEnergy;            ///< The cluster electromagnetic energies
+        pandora::FloatVector        m_clusterNHits;             ///< The cluster hit counts, stored as floats
+        pandora::FloatVector        m_minLayerPositionX;        ///< The x coordinates of the fit positions at the min layer
+        pandora::FloatVector        m_minLayerPositionZ;        ///< The z coordinates of the fit positions at the min layer
+        pandora::FloatVector        m_maxLayerPositionX;        ///< The x coordinates of the fit positions at the max layer
+        pandora::FloatVector        m_maxLayerPositionZ;        ///< The z coordinates of the fit positions at the max layer
+        pandora::FloatVector        m_minLayerDirectionX;       ///< The x components of the fit directions at the min layer
+        pandora::FloatVector        m_minLayerDirectionZ;       ///< The z components of the fit directions at the min layer
+        pandora::FloatVector        m_maxLayerDirectionX;       ///< The x components of the fit directions at the max layer
+        pandora::FloatVector        m_maxLayerDirectionZ;       ///< The z components of the fit directions at the max layer
+        std::vector<unsigned int>   m_hitOffsets;               ///< The offsets of the hits of each cluster in the hit arrays (size n clusters + 1)
+        pandora::FloatVector        m_hitPositionX;             ///< The hit x positions, sorted by position within each cluster
+        pandora::FloatVector        m_hitPositionZ;             ///< The hit z positions, sorted by position within each cluster
+        pandora::FloatVector        m_hitEnergy;                ///< The hit electromagnetic energies, sorted by position within each cluster
+    };
+
+    /**
+     *  @brief Vertex position batch class, a structure-of-arrays copy of the vertex candidate positions projected into a single view
+     */
+    class VertexPositionBatch
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pandora the associated pandora instance
+         *  @param  vertexVector the vertex vector
+         *  @param  hitType the view into which to project the vertex positions
+         */
+        VertexPositionBatch(const pandora::Pandora &pandora, const pandora::VertexVector &vertexVector, const pandora::HitType hitType);
+
+        /**
+         *  @brief  Get the number of vertices in the batch
+         *
+         *  @return the number of vertices
+         */
+        unsigned int GetNVertices() const;
+
+        pandora::FloatVector        m_positionX;                ///< The projected vertex x positions, in vertex vector order
+        pandora::FloatVector        m_positionZ;                ///< The projected vertex z positions, in vertex vector order
+    };
+
     typedef KDTreeNodeInfoT<const pandora::CaloHit*, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
     typedef KDTreeLinkerAlgo<const pandora::CaloHit*, 2> HitKDTree2D;
@@ -228,6 +303,34 @@ public:
     typedef SvmFeatureTool<const VertexSelectionBaseAlgorithm *const, const pandora::Vertex * const, const SlidingFitDataListMap &,
         const ClusterListMap &, const KDTreeMap &, const ShowerClusterListMap &, const float, float &>  VertexFeatureTool; ///< The base type for the vertex feature tools
 
+    typedef std::map<pandora::HitType, const SlidingFitDataBatch>                 SlidingFitDataBatchMap;  ///< Map of sliding fit data batches for passing to tools
+    typedef std::map<pandora::HitType, const VertexPositionBatch>                 VertexPositionBatchMap;  ///< Map of vertex position batches for passing to tools
+
+    /**
+     *  @brief  BatchVertexFeatureTool class, the interface for vertex feature tools able to evaluate all vertex candidates in one pass over the clusters
+     */
+    class BatchVertexFeatureTool
+    {
+    public:
+        /**
+         *  @brief  Destructor
+         */
+        virtual ~BatchVertexFeatureTool() = default;
+
+        /**
+         *  @brief  Run the tool for all vertex candidates
+         *
+         *  @param  featureVector the vector of features to append, receiving one feature per vertex, in vertex vector order
+         *  @param  pAlgorithm address of the calling algorithm
+         *  @param  vertexPositionBatchMap map of the projected vertex position batches
+         *  @param  slidingFitDataBatchMap map of the sliding fit data batches
+         *  @param  showerClusterListMap map of the shower cluster lists
+         */
+        virtual void RunBatch(SupportVectorMachine::DoubleVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+            const VertexPositionBatchMap &vertexPositionBatchMap, const SlidingFitDataBatchMap &slidingFitDataBatchMap,
+            const ShowerClusterListMap &showerClusterListMap) = 0;
+    };
+
 protected:
     /**
      *  @brief  Filter the input list of vertices to obtain a reduced number of vertex candidates
@@ -284,6 +387,39 @@ protected:
     void CalculateClusterSlidingFits(const pandora::ClusterList &inputClusterList, const unsigned int minClusterCaloHits,
         const unsigned int slidingFitWindow, SlidingFitDataList &slidingFitDataList) const;
 
+    /**
+     *  @brief  Get the projected vertex position and sliding fit data batches in each view, for batched feature evaluation
+     *
+     *  @param  vertexVector the vertex vector
+     *  @param  slidingFitDataListMap map of the sliding fit data lists
+     *  @param  vertexPositionBatchMap to receive the projected vertex position batches
+     *  @param  slidingFitDataBatchMap to receive the sliding fit data batches
+     */
+    void GetFeatureBatchMaps(const pandora::VertexVector &vertexVector, const SlidingFitDataListMap &slidingFitDataListMap,
+        VertexPositionBatchMap &vertexPositionBatchMap, SlidingFitDataBatchMap &slidingFitDataBatchMap) const;
+
+    /**
+     *  @brief  Calculate the features of a given feature tool type for all vertex candidates, using the batched interface if the tool provides
+     *          it and otherwise falling back on one tool call per vertex
+     *
+     *  @param  featureToolVector the feature tool vector
+     *  @param  vertexVector the vertex vector
+     *  @param  vertexPositionBatchMap map of the projected vertex position batches
+     *  @param  slidingFitDataBatchMap map of the sliding fit data batches
+     *  @param  slidingFitDataListMap map of the sliding fit data lists
+     *  @param  clusterListMap map of the cluster lists
+     *  @param  kdTreeMap map of the hit kd trees
+     *  @param  showerClusterListMap map of the shower cluster lists
+     *  @param  beamDeweightingVector the beam deweighting scores, in vertex vector order
+     *
+     *  @return the vector of features, one per vertex, in vertex vector order
+     */
+    template <typename T>
+    SupportVectorMachine::DoubleVector CalculateBatchFeaturesOfType(const VertexFeatureTool::FeatureToolVector &featureToolVector,
+        const pandora::VertexVector &vertexVector, const VertexPositionBatchMap &vertexPositionBatchMap, const SlidingFitDataBatchMap &slidingFitDataBatchMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ClusterListMap &clusterListMap, const KDTreeMap &kdTreeMap,
+        const ShowerClusterListMap &showerClusterListMap, const pandora::FloatVector &beamDeweightingVector) const;
+
     /**
      *  @brief  Get the beam deweighting score for a vertex
      *
@@ -301,6 +437,13 @@ protected:
      */
     bool IsBeamModeOn() const;
 
+    /**
+     *  @brief  Whether to evaluate vertex features for all candidates at once, via feature tools offering the batched interface
+     *
+     *  @return boolean
+     */
+    bool IsBatchFeatureEvaluationOn() const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
@@ -383,9 +526,12 @@ private:
 
     bool                    m_useDetectorGaps;              ///< Whether to account for registered detector gaps in vertex selection
     float                   m_gapTolerance;                 ///< The tolerance to use when querying whether a sampling point is in a gap, units cm
+    LArGeometryHelper::DetectorGapIndex m_detectorGapIndex; ///< The index of the detector gaps, rebuilt from the gap list for each run
 
     bool                    m_isEmptyViewAcceptable;        ///< Whether views entirely empty of hits are classed as 'acceptable' for candidate filtration
     unsigned int            m_minVertexAcceptableViews;     ///< The minimum number of views in which a candidate must sit on/near a hit or in a gap (or view can be empty)
+
+    bool                    m_batchFeatureEvaluation;       ///< Whether to evaluate vertex features for all candidates at once, where tools allow
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -398,11 +544,54 @@ inline float VertexSelectionBaseAlgorithm::GetBeamDeweightingScore(const BeamCon
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+SupportVectorMachine::DoubleVector VertexSelectionBaseAlgorithm::CalculateBatchFeaturesOfType(const VertexFeatureTool::FeatureToolVector &featureToolVector,
+    const pandora::VertexVector &vertexVector, const VertexPositionBatchMap &vertexPositionBatchMap, const SlidingFitDataBatchMap &slidingFitDataBatchMap,
+    const SlidingFitDataListMap &slidingFitDataListMap, const ClusterListMap &clusterListMap, const KDTreeMap &kdTreeMap,
+    const ShowerClusterListMap &showerClusterListMap, const pandora::FloatVector &beamDeweightingVector) const
+{
+    using TD = typename std::decay<T>::type;
+    SupportVectorMachine::DoubleVector featureVector;
+
+    for (VertexFeatureTool *const pFeatureTool : featureToolVector)
+    {
+        TD *const pCastFeatureTool = dynamic_cast<TD *const>(pFeatureTool);
+
+        if (!pCastFeatureTool)
+            continue;
+
+        if (BatchVertexFeatureTool *const pBatchFeatureTool = dynamic_cast<BatchVertexFeatureTool *const>(pCastFeatureTool))
+        {
+            pBatchFeatureTool->RunBatch(featureVector, this, vertexPositionBatchMap, slidingFitDataBatchMap, showerClusterListMap);
+            continue;
+        }
+
+        float bestFastScore(-std::numeric_limits<float>::max()); // not actually used - artefact of toolizing RPhi score and still using performance trick
+
+        for (unsigned int iVertex = 0; iVertex < vertexVector.size(); ++iVertex)
+        {
+            pCastFeatureTool->Run(featureVector, this, vertexVector.at(iVertex), slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap,
+                beamDeweightingVector.at(iVertex), bestFastScore);
+        }
+    }
+
+    return featureVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline bool VertexSelectionBaseAlgorithm::IsBeamModeOn() const
 {
     return m_beamMode;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool VertexSelectionBaseAlgorithm::IsBatchFeatureEvaluationOn() const
+{
+    return m_batchFeatureEvaluation;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -493,6 +682,20 @@ inline const pandora::Cluster *VertexSelectionBaseAlgorithm::SlidingFitData::Get
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int VertexSelectionBaseAlgorithm::SlidingFitDataBatch::GetNClusters() const
+{
+    return m_clusterVector.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int VertexSelectionBaseAlgorithm::VertexPositionBatch::GetNVertices() const
+{
+    return m_positionX.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const pandora::ClusterList &VertexSelectionBaseAlgorithm::ShowerCluster::GetClusters() const
 {
     return m_clusterList;